@@ -0,0 +1,82 @@
+# cotila_bake(<target> OUTPUT <header>
+#             EXPR <name> <expression> [<name> <expression> ...]
+#             [NAMESPACE <namespace>] [INCLUDES <header> ...] [ALIGN <bytes>])
+#
+# Evaluates Cotila constant expressions once at build time and writes the
+# results to <header> as `inline constexpr` literals, so translation units that
+# include it no longer re-evaluate the expressions themselves.
+#
+# The header is generated relative to the current binary directory, which is
+# added to the include path of <target>.  Values are placed in <namespace>
+# (default `cotila_baked`) and aligned to <bytes> (default 64).  Each
+# expression is evaluated as a `constexpr` variable in a small generator
+# program linked against `cotila::cotila`, and may not contain semicolons.
+set_property(GLOBAL PROPERTY COTILA_BAKE_TEMPLATE "${CMAKE_CURRENT_LIST_DIR}/cotila-bake.cpp.in")
+
+function(cotila_bake target)
+	cmake_parse_arguments(PARSE_ARGV 1 BAKE "" "OUTPUT;NAMESPACE;ALIGN" "EXPR;INCLUDES")
+	if (NOT BAKE_OUTPUT)
+		message(FATAL_ERROR "cotila_bake: OUTPUT is required")
+	endif()
+	list(LENGTH BAKE_EXPR expr_length)
+	math(EXPR expr_odd "${expr_length} % 2")
+	if (expr_length EQUAL 0 OR expr_odd)
+		message(FATAL_ERROR "cotila_bake: EXPR requires <name> <expression> pairs")
+	endif()
+	if (NOT BAKE_NAMESPACE)
+		set(BAKE_NAMESPACE cotila_baked)
+	endif()
+	if (NOT BAKE_ALIGN)
+		set(BAKE_ALIGN 64)
+	endif()
+
+	get_property(template GLOBAL PROPERTY COTILA_BAKE_TEMPLATE)
+	string(MAKE_C_IDENTIFIER "${BAKE_OUTPUT}" output_id)
+	string(TOUPPER "COTILA_BAKED_${output_id}_" COTILA_BAKE_GUARD)
+	set(COTILA_BAKE_NAMESPACE "${BAKE_NAMESPACE}")
+	set(COTILA_BAKE_ALIGN "${BAKE_ALIGN}")
+
+	set(COTILA_BAKE_INCLUDES "")
+	foreach(include ${BAKE_INCLUDES})
+		string(APPEND COTILA_BAKE_INCLUDES "#include <${include}>\n")
+	endforeach()
+
+	set(COTILA_BAKE_VALUES "")
+	math(EXPR last "${expr_length} - 1")
+	foreach(i RANGE 0 ${last} 2)
+		math(EXPR j "${i} + 1")
+		list(GET BAKE_EXPR ${i} name)
+		list(GET BAKE_EXPR ${j} expression)
+		string(APPEND COTILA_BAKE_VALUES
+			"  {\n"
+			"    constexpr auto value = (${expression});\n"
+			"    cotila_bake::emit(out, \"${name}\", value);\n"
+			"  }\n")
+	endforeach()
+
+	set(generator "cotila_bake_${target}_${output_id}")
+	set(source "${CMAKE_CURRENT_BINARY_DIR}/${generator}.cpp")
+	set(header "${CMAKE_CURRENT_BINARY_DIR}/${BAKE_OUTPUT}")
+	get_filename_component(header_dir "${header}" DIRECTORY)
+	configure_file("${template}" "${source}" @ONLY)
+
+	add_executable(${generator} "${source}")
+	target_link_libraries(${generator} PRIVATE cotila::cotila)
+	if (BAKE_INCLUDES)
+		get_target_property(target_includes ${target} INCLUDE_DIRECTORIES)
+		if (target_includes)
+			target_include_directories(${generator} PRIVATE ${target_includes})
+		endif()
+	endif()
+
+	add_custom_command(
+		OUTPUT "${header}"
+		COMMAND ${CMAKE_COMMAND} -E make_directory "${header_dir}"
+		COMMAND ${generator} "${header}"
+		DEPENDS ${generator}
+		COMMENT "Baking Cotila constants into ${BAKE_OUTPUT}"
+		VERBATIM
+	)
+	target_sources(${target} PRIVATE "${header}")
+	target_include_directories(${target} PRIVATE "${CMAKE_CURRENT_BINARY_DIR}")
+endfunction()
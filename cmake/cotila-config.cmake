@@ -0,0 +1,2 @@
+include("${CMAKE_CURRENT_LIST_DIR}/cotila-targets.cmake")
+include("${CMAKE_CURRENT_LIST_DIR}/cotila-bake.cmake")
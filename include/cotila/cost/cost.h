@@ -0,0 +1,283 @@
+/** @file
+ *  @brief Compile-time cost model of operations.
+ */
+
+#ifndef COTILA_COST_COST_H_
+#define COTILA_COST_COST_H_
+
+#include <cotila/detail/type_traits.h>
+#include <cotila/matrix/math.h>
+#include <cotila/matrix/matrix.h>
+#include <cotila/vector/vector.h>
+#include <cstddef>
+#include <type_traits>
+
+namespace cotila {
+
+/** @brief Tags identifying operations in `cotila::cost`
+ *  \ingroup cost
+ */
+namespace op {
+struct matmul {};      ///< @brief `cotila::matmul`
+struct matvec {};      ///< @brief `cotila::matvec`
+struct inverse {};     ///< @brief `cotila::inverse`
+struct det {};         ///< @brief `cotila::det`
+struct kron {};        ///< @brief `cotila::kron`
+struct transpose {};   ///< @brief `cotila::transpose`
+struct elementwise {}; ///< @brief `cotila::elementwise` and arithmetic operators
+struct sum {};         ///< @brief `cotila::sum`
+struct min {};         ///< @brief `cotila::min`
+struct max {};         ///< @brief `cotila::max`
+struct dot {};         ///< @brief `cotila::dot`
+} // namespace op
+
+/// @private
+namespace detail {
+
+// Real floating point operations per scalar operation
+template <typename T>
+constexpr std::size_t add_flops = is_complex_v<T> ? 2 : 1;
+template <typename T>
+constexpr std::size_t mul_flops = is_complex_v<T> ? 6 : 1;
+template <typename T>
+constexpr std::size_t div_flops = is_complex_v<T> ? 11 : 1;
+
+// Scalar multiplications and additions of an m x n by n x p product,
+// following the dispatch of matmul between the direct kernel and the
+// Strassen-Winograd recursion
+struct matmul_count {
+  std::size_t muls, adds;
+};
+
+constexpr matmul_count count_matmul(std::size_t m, std::size_t n,
+                                    std::size_t p, std::size_t cutoff) {
+  if (m <= cutoff || n <= cutoff || p <= cutoff)
+    return {m * n * p, m * p * (n - 1)};
+  const std::size_t m2 = m / 2, n2 = n / 2, p2 = p / 2;
+  // Seven half size products, and the additions of the S, T and U terms
+  auto half = count_matmul(m2, n2, p2, cutoff);
+  matmul_count count = {7 * half.muls, 7 * half.adds + 4 * m2 * n2 +
+                                           4 * n2 * p2 + 7 * m2 * p2};
+  // Peeled inner dimension, last column and last row
+  if (n % 2)
+    count = {count.muls + 4 * m2 * p2, count.adds + 4 * m2 * p2};
+  if (p % 2)
+    count = {count.muls + m * n, count.adds + m * (n - 1)};
+  if (m % 2)
+    count = {count.muls + 2 * p2 * n, count.adds + 2 * p2 * (n - 1)};
+  return count;
+}
+
+template <typename T> struct operand {
+  using value_type = T;
+  static constexpr std::size_t size = 1;
+};
+
+template <typename T, std::size_t N> struct operand<vector<T, N>> {
+  using value_type = T;
+  static constexpr std::size_t size = N;
+};
+
+template <typename T, std::size_t M, std::size_t N>
+struct operand<matrix<T, M, N>> {
+  using value_type = T;
+  static constexpr std::size_t size = M * N;
+};
+
+template <typename T> constexpr std::size_t operand_bytes =
+    operand<T>::size * sizeof(typename operand<T>::value_type);
+
+// Gauss-Jordan elimination of a full rank M x N matrix, with a pivot in each
+// of the first M columns
+template <typename T, std::size_t M, std::size_t N>
+constexpr std::size_t gauss_jordan_flops =
+    M * (N * div_flops<T> + (M - 1) * N * (mul_flops<T> + add_flops<T>));
+
+} // namespace detail
+
+/** \addtogroup cost
+ *  @{
+ */
+
+/** @brief The cost of an operation
+ *  @tparam Op a tag from `cotila::op` identifying the operation
+ *  @tparam Args the types of the operands
+ *
+ *  `cotila::cost` describes the work done by an operation on operands of the
+ *  given types, computed entirely from their compile-time dimensions.  Each
+ *  specialization has the following members:
+ *  * `flops`, the number of real floating point operations (a complex
+ *    addition counts as 2, a complex multiplication as 6 and a complex division
+ *    as 11),
+ *  * `bytes_read`, the size of the operands, and
+ *  * `bytes_written`, the size of the result.
+ *
+ *  Memory traffic counts each operand and result once, as if it were held in
+ *  cache for the duration of the operation.  This is useful for static
+ *  scheduling decisions and performance budgets:
+ *  \code{.cpp}
+ *  using m = cotila::matrix<double, 8, 8>;
+ *  static_assert(cotila::cost<cotila::op::matmul, m, m>::flops < 1024);
+ *  \endcode
+ */
+template <typename Op, typename... Args> struct cost;
+
+/** @brief The cost of `cotila::matmul`
+ *
+ *  Below `COTILA_STRASSEN_CUTOFF`, each of the \f$ M P \f$ elements requires
+ *  N multiplications and \f$ N - 1 \f$ additions.  Above it, the flops follow
+ *  the Strassen-Winograd recursion of `cotila::matmul`: seven half size
+ *  products and fifteen additions of blocks per level.  Memory traffic counts
+ *  the operands and the result, not the temporaries of the recursion.
+ */
+template <typename T, std::size_t M, std::size_t N, std::size_t P>
+struct cost<op::matmul, matrix<T, M, N>, matrix<T, N, P>> {
+private:
+  static constexpr auto count =
+      detail::count_matmul(M, N, P, COTILA_STRASSEN_CUTOFF);
+
+public:
+  static constexpr std::size_t flops = count.muls * detail::mul_flops<T> +
+                                       count.adds * detail::add_flops<T>;
+  static constexpr std::size_t bytes_read = (M * N + N * P) * sizeof(T);
+  static constexpr std::size_t bytes_written = M * P * sizeof(T);
+};
+
+/** @brief The cost of `cotila::matvec`
+ *
+ *  Each of the M elements requires N multiplications and \f$ N - 1 \f$
+ *  additions.
+ */
+template <typename T, std::size_t M, std::size_t N>
+struct cost<op::matvec, matrix<T, M, N>, vector<T, N>> {
+  static constexpr std::size_t flops =
+      M * (N * detail::mul_flops<T> + (N - 1) * detail::add_flops<T>);
+  static constexpr std::size_t bytes_read = (M * N + N) * sizeof(T);
+  static constexpr std::size_t bytes_written = M * sizeof(T);
+};
+
+/** @brief The cost of `cotila::inverse`
+ *
+ *  The inverse is computed by Gauss-Jordan elimination of
+ *  \f$ \left[ \textbf{m} \vert \textbf{I} \right] \f$, skipping the columns
+ *  to the left of each pivot.
+ */
+template <typename T, std::size_t M> struct cost<op::inverse, matrix<T, M, M>> {
+  static constexpr std::size_t flops =
+      (3 * M * M - M) / 2 * detail::div_flops<T> +
+      (M - 1) * (3 * M * M - M) / 2 *
+          (detail::mul_flops<T> + detail::add_flops<T>);
+  static constexpr std::size_t bytes_read = M * M * sizeof(T);
+  static constexpr std::size_t bytes_written = M * M * sizeof(T);
+};
+
+/** @brief The cost of `cotila::det`
+ *
+ *  The determinant is computed by Gauss-Jordan elimination, accumulating the
+ *  product of the pivots.  For integral T it is computed by Bareiss
+ *  elimination, where each of the \f$ \sum_{k=1}^{M-1} k^2 \f$ updated
+ *  elements requires two multiplications, a subtraction and a division.
+ */
+template <typename T, std::size_t M> struct cost<op::det, matrix<T, M, M>> {
+  static constexpr std::size_t flops =
+      std::is_integral_v<T>
+          ? (M - 1) * M * (2 * M - 1) / 6 * 4
+          : detail::gauss_jordan_flops<T, M, M> + M * detail::mul_flops<T>;
+  static constexpr std::size_t bytes_read = M * M * sizeof(T);
+  static constexpr std::size_t bytes_written = sizeof(T);
+};
+
+/** @brief The cost of `cotila::kron`
+ *
+ *  Each of the \f$ M N P Q \f$ elements requires one multiplication.
+ */
+template <typename T, std::size_t M, std::size_t N, std::size_t P,
+          std::size_t Q>
+struct cost<op::kron, matrix<T, M, N>, matrix<T, P, Q>> {
+  static constexpr std::size_t flops = M * N * P * Q * detail::mul_flops<T>;
+  static constexpr std::size_t bytes_read = (M * N + P * Q) * sizeof(T);
+  static constexpr std::size_t bytes_written = M * N * P * Q * sizeof(T);
+};
+
+/** @brief The cost of `cotila::transpose`
+ *
+ *  Transposition only moves data.
+ */
+template <typename T, std::size_t M, std::size_t N>
+struct cost<op::transpose, matrix<T, M, N>> {
+  static constexpr std::size_t flops = 0;
+  static constexpr std::size_t bytes_read = M * N * sizeof(T);
+  static constexpr std::size_t bytes_written = M * N * sizeof(T);
+};
+
+/** @brief The cost of `cotila::elementwise`
+ *
+ *  The operation is assumed to be a single arithmetic operation combining the
+ *  arguments, such as the elementwise arithmetic operators, so each element
+ *  of the result requires one operation per argument after the first (or one
+ *  operation if there is only one argument).  Scalar arguments are broadcast.
+ */
+template <typename First, typename... Args>
+struct cost<op::elementwise, First, Args...> {
+private:
+  using value_type = typename detail::operand<First>::value_type;
+  static constexpr std::size_t size = detail::operand<First>::size;
+  static constexpr std::size_t operations =
+      sizeof...(Args) > 0 ? sizeof...(Args) : 1;
+
+public:
+  static constexpr std::size_t flops =
+      size * operations * detail::add_flops<value_type>;
+  static constexpr std::size_t bytes_read =
+      (detail::operand_bytes<First> + ... + detail::operand_bytes<Args>);
+  static constexpr std::size_t bytes_written = size * sizeof(value_type);
+};
+
+/** @brief The cost of `cotila::sum`
+ *
+ *  Summing N elements requires \f$ N - 1 \f$ additions.
+ */
+template <typename T, std::size_t N> struct cost<op::sum, vector<T, N>> {
+  static constexpr std::size_t flops = (N - 1) * detail::add_flops<T>;
+  static constexpr std::size_t bytes_read = N * sizeof(T);
+  static constexpr std::size_t bytes_written = sizeof(T);
+};
+
+/** @brief The cost of `cotila::min`
+ *
+ *  Finding the minimum of N elements requires \f$ N - 1 \f$ comparisons.
+ */
+template <typename T, std::size_t N> struct cost<op::min, vector<T, N>> {
+  static constexpr std::size_t flops = N - 1;
+  static constexpr std::size_t bytes_read = N * sizeof(T);
+  static constexpr std::size_t bytes_written = sizeof(T);
+};
+
+/** @brief The cost of `cotila::max`
+ *
+ *  Finding the maximum of N elements requires \f$ N - 1 \f$ comparisons.
+ */
+template <typename T, std::size_t N> struct cost<op::max, vector<T, N>> {
+  static constexpr std::size_t flops = N - 1;
+  static constexpr std::size_t bytes_read = N * sizeof(T);
+  static constexpr std::size_t bytes_written = sizeof(T);
+};
+
+/** @brief The cost of `cotila::dot`
+ *
+ *  The dot product of N-vectors requires N multiplications and \f$ N - 1 \f$
+ *  additions (complex conjugation is free).
+ */
+template <typename T, std::size_t N>
+struct cost<op::dot, vector<T, N>, vector<T, N>> {
+  static constexpr std::size_t flops =
+      N * detail::mul_flops<T> + (N - 1) * detail::add_flops<T>;
+  static constexpr std::size_t bytes_read = 2 * N * sizeof(T);
+  static constexpr std::size_t bytes_written = sizeof(T);
+};
+
+/** @}*/
+
+} // namespace cotila
+
+#endif // COTILA_COST_COST_H_
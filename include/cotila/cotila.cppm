@@ -0,0 +1,162 @@
+/** @file
+ *  @brief C++20 module interface for Cotila.
+ *
+ *  Exports the contents of `cotila/cotila.h` as the module `cotila`.  Built by
+ *  the `cotila::module` CMake target when `BUILD_MODULE` is enabled.
+ */
+
+module;
+
+#include <cotila/cotila.h>
+
+export module cotila;
+
+export namespace cotila {
+
+// scalar
+using cotila::abs;
+using cotila::conj;
+using cotila::cos;
+using cotila::exponentiate;
+using cotila::nthroot;
+using cotila::sin;
+using cotila::sqrt;
+
+// vector
+using cotila::vector;
+using cotila::make_vector;
+using cotila::accumulate;
+using cotila::argsort;
+using cotila::cast;
+using cotila::concat;
+using cotila::cosine_distance;
+using cotila::cumprod;
+using cotila::cumsum;
+using cotila::diff;
+using cotila::dot;
+using cotila::elementwise;
+using cotila::exclusive_scan;
+using cotila::fill;
+using cotila::generate;
+using cotila::imag;
+using cotila::inclusive_scan;
+using cotila::iota;
+using cotila::l1_distance;
+using cotila::linspace;
+using cotila::max;
+using cotila::max_index;
+using cotila::median;
+using cotila::min;
+using cotila::min_index;
+using cotila::nearest;
+using cotila::norm1;
+using cotila::norm2;
+using cotila::norminf;
+using cotila::normalize;
+using cotila::nth_element;
+using cotila::real;
+using cotila::rotate;
+using cotila::slice;
+using cotila::sort;
+using cotila::squared_distance;
+using cotila::sum;
+
+// matrix
+using cotila::matrix;
+using cotila::axis;
+using cotila::axis_vector;
+using cotila::along;
+using cotila::as_column;
+using cotila::as_matrix;
+using cotila::as_row;
+using cotila::broadcast;
+using cotila::compose;
+using cotila::det;
+using cotila::expm;
+using cotila::hermitian;
+using cotila::horzcat;
+using cotila::identity;
+using cotila::inverse;
+using cotila::kron;
+using cotila::kron_apply;
+using cotila::kron_view;
+using cotila::logm;
+using cotila::macs;
+using cotila::mars;
+using cotila::gemv;
+using cotila::ger;
+using cotila::matmul;
+using cotila::matpow;
+using cotila::matvec;
+using cotila::matvec_h;
+using cotila::matvec_t;
+using cotila::mean;
+using cotila::multi_matmul;
+using cotila::norm;
+using cotila::normfro;
+using cotila::outer;
+using cotila::permutation;
+using cotila::permute;
+using cotila::rank;
+using cotila::repmat;
+using cotila::reshape;
+using cotila::rref;
+using cotila::sqrtm;
+using cotila::submat;
+using cotila::swapcol;
+using cotila::swaprow;
+using cotila::syrk;
+using cotila::syrk_t;
+using cotila::trace;
+using cotila::transform;
+using cotila::transform_affine;
+using cotila::transpose;
+using cotila::try_inverse;
+using cotila::vecmat;
+using cotila::vertcat;
+
+// polynomial
+using cotila::polynomial;
+using cotila::derivative;
+using cotila::polyfit;
+using cotila::roots;
+
+// signal
+using cotila::fir;
+using cotila::decimator;
+using cotila::blackman;
+using cotila::fft;
+using cotila::hamming;
+using cotila::hann;
+using cotila::interpolation;
+using cotila::lut;
+using cotila::make_lut;
+using cotila::ifft;
+using cotila::lowpass;
+using cotila::rfft;
+
+// cost
+using cotila::cost;
+namespace op {
+using cotila::op::det;
+using cotila::op::dot;
+using cotila::op::elementwise;
+using cotila::op::inverse;
+using cotila::op::kron;
+using cotila::op::matmul;
+using cotila::op::matvec;
+using cotila::op::max;
+using cotila::op::min;
+using cotila::op::sum;
+using cotila::op::transpose;
+} // namespace op
+
+// operators (operator- is only declared for broadcasts, in broadcast.h)
+using cotila::operator==;
+using cotila::operator!=;
+using cotila::operator+;
+using cotila::operator-;
+using cotila::operator*;
+using cotila::operator/;
+
+} // namespace cotila
@@ -1,14 +1,26 @@
 #ifndef COTILA_COTILA_H_
 #define COTILA_COTILA_H_
 
+#include <cotila/cost/cost.h>
+#include <cotila/matrix/broadcast.h>
+#include <cotila/matrix/kron_view.h>
 #include <cotila/matrix/math.h>
 #include <cotila/matrix/matrix.h>
 #include <cotila/matrix/operators.h>
+#include <cotila/matrix/permutation.h>
 #include <cotila/matrix/utility.h>
+#include <cotila/polynomial/polynomial.h>
 #include <cotila/scalar/math.h>
+#include <cotila/signal/fft.h>
+#include <cotila/signal/fir.h>
+#include <cotila/signal/lut.h>
+#include <cotila/signal/window.h>
 #include <cotila/vector/math.h>
 #include <cotila/vector/operators.h>
+#include <cotila/vector/sort.h>
 #include <cotila/vector/utility.h>
 #include <cotila/vector/vector.h>
 
+#include <cotila/detail/precompiled.h>
+
 #endif // COTILA_COTILA_H_
@@ -0,0 +1,67 @@
+#ifndef COTILA_DETAIL_COMPLEX_H_
+#define COTILA_DETAIL_COMPLEX_H_
+
+#include <cotila/detail/type_traits.h>
+
+namespace cotila {
+namespace detail {
+
+// The std::complex arithmetic operators are not constexpr until C++20, so
+// these are used wherever real or complex values are combined in a constant
+// expression.
+
+template <typename T> constexpr T add(const T &a, const T &b) {
+  if constexpr (is_complex_v<T>)
+    return {a.real() + b.real(), a.imag() + b.imag()};
+  else
+    return a + b;
+}
+
+template <typename T> constexpr T sub(const T &a, const T &b) {
+  if constexpr (is_complex_v<T>)
+    return {a.real() - b.real(), a.imag() - b.imag()};
+  else
+    return a - b;
+}
+
+template <typename T> constexpr T mul(const T &a, const T &b) {
+  if constexpr (is_complex_v<T>)
+    return {a.real() * b.real() - a.imag() * b.imag(),
+            a.real() * b.imag() + a.imag() * b.real()};
+  else
+    return a * b;
+}
+
+template <typename T> constexpr remove_complex_t<T> abs2(const T &a) {
+  if constexpr (is_complex_v<T>)
+    return a.real() * a.real() + a.imag() * a.imag();
+  else
+    return a * a;
+}
+
+template <typename T> constexpr T div(const T &a, const T &b) {
+  if constexpr (is_complex_v<T>) {
+    // Smith's algorithm, which avoids overflow in the denominator
+    auto br = b.real(), bi = b.imag();
+    if ((br < 0 ? -br : br) >= (bi < 0 ? -bi : bi)) {
+      auto r = bi / br, d = br + bi * r;
+      return {(a.real() + a.imag() * r) / d, (a.imag() - a.real() * r) / d};
+    } else {
+      auto r = br / bi, d = bi + br * r;
+      return {(a.real() * r + a.imag()) / d, (a.imag() * r - a.real()) / d};
+    }
+  } else
+    return a / b;
+}
+
+template <typename T> constexpr T scale(const T &a, remove_complex_t<T> s) {
+  if constexpr (is_complex_v<T>)
+    return {a.real() * s, a.imag() * s};
+  else
+    return a * s;
+}
+
+} // namespace detail
+} // namespace cotila
+
+#endif // COTILA_DETAIL_COMPLEX_H_
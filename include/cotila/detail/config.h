@@ -0,0 +1,67 @@
+#ifndef COTILA_DETAIL_CONFIG_H_
+#define COTILA_DETAIL_CONFIG_H_
+
+#include <cstdlib>
+
+// COTILA_DETAIL_IS_CONSTANT_EVALUATED() is true during constant evaluation.
+// Functions use it to select faster non-constexpr implementations at run time.
+// On compilers without the builtin it is always true, so the constexpr
+// implementations are used everywhere.
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define COTILA_DETAIL_HAS_IS_CONSTANT_EVALUATED
+#endif
+#endif
+#if !defined(COTILA_DETAIL_HAS_IS_CONSTANT_EVALUATED) &&                       \
+    ((defined(__GNUC__) && __GNUC__ >= 9) ||                                   \
+     (defined(_MSC_VER) && _MSC_VER >= 1925))
+#define COTILA_DETAIL_HAS_IS_CONSTANT_EVALUATED
+#endif
+
+#ifdef COTILA_DETAIL_HAS_IS_CONSTANT_EVALUATED
+#define COTILA_DETAIL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define COTILA_DETAIL_IS_CONSTANT_EVALUATED() true
+#endif
+
+// COTILA_DETAIL_THROW(message) reports an error by throwing the message.  When
+// exceptions are disabled it aborts instead.  Either way, reaching it during
+// constant evaluation is a compile error.
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define COTILA_DETAIL_THROW(message) throw message
+#else
+#define COTILA_DETAIL_THROW(message) std::abort()
+#endif
+
+// COTILA_BOUNDS_CHECK enables bounds checking of run time indices, and
+// defaults to enabled unless NDEBUG is defined.  It is documented for users in
+// the README and on the main documentation page.
+#ifndef COTILA_BOUNDS_CHECK
+#ifdef NDEBUG
+#define COTILA_BOUNDS_CHECK 0
+#else
+#define COTILA_BOUNDS_CHECK 1
+#endif
+#endif
+
+// COTILA_DETAIL_CHECK_BOUNDS(in_range) reports an error if in_range is false,
+// subject to COTILA_BOUNDS_CHECK.
+#if COTILA_BOUNDS_CHECK
+#define COTILA_DETAIL_CHECK_BOUNDS(in_range)                                   \
+  do {                                                                         \
+    if (!(in_range))                                                           \
+      COTILA_DETAIL_THROW("index out of range");                               \
+  } while (false)
+#elif defined(COTILA_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+#define COTILA_DETAIL_CHECK_BOUNDS(in_range)                                   \
+  do {                                                                         \
+    if (__builtin_is_constant_evaluated() && !(in_range))                      \
+      COTILA_DETAIL_THROW("index out of range");                               \
+  } while (false)
+#else
+#define COTILA_DETAIL_CHECK_BOUNDS(in_range)                                   \
+  do {                                                                         \
+  } while (false)
+#endif
+
+#endif // COTILA_DETAIL_CONFIG_H_
@@ -0,0 +1,83 @@
+#ifndef COTILA_DETAIL_PRECOMPILED_H_
+#define COTILA_DETAIL_PRECOMPILED_H_
+
+#include <complex>
+#include <cotila/matrix/math.h>
+#include <cotila/matrix/matrix.h>
+#include <cotila/matrix/operators.h>
+#include <optional>
+
+// Explicit instantiations provided by the `cotila::precompiled` library.
+// Expanded with `PREFIX` as `template` in the library and `extern template`
+// in code linking against it (see COTILA_PRECOMPILED).
+//
+// The functions are constexpr, and so inline, and the standard does not let an
+// explicit instantiation declaration suppress implicit instantiation of inline
+// functions ([temp.explicit]).  The declarations only permit the compiler to
+// rely on the library's definitions instead of emitting its own; GCC and Clang
+// do so for calls they do not inline, but no compiler is required to.
+//
+// Every translation unit must see the same definitions as the library, or the
+// program violates the one definition rule.  In particular
+// COTILA_BOUNDS_CHECK, which defaults from NDEBUG, and whether exceptions are
+// enabled must match the library.  The CMake target exports the library's
+// COTILA_BOUNDS_CHECK as an interface definition for this reason.
+
+#define COTILA_DETAIL_PRECOMPILED_ARITHMETIC(PREFIX, T, N)                     \
+  PREFIX matrix<T, N, N> matmul(const matrix<T, N, N> &,                       \
+                                const matrix<T, N, N> &);                      \
+  PREFIX matrix<T, N, N> transpose(const matrix<T, N, N> &);                   \
+  PREFIX bool operator==(const matrix<T, N, N> &, const matrix<T, N, N> &);    \
+  PREFIX bool operator!=(const matrix<T, N, N> &, const matrix<T, N, N> &);    \
+  PREFIX matrix<T, N, N> operator+(const matrix<T, N, N> &, T);                \
+  PREFIX matrix<T, N, N> operator+(T, const matrix<T, N, N> &);                \
+  PREFIX matrix<T, N, N> operator+(const matrix<T, N, N> &,                    \
+                                   const matrix<T, N, N> &);                   \
+  PREFIX matrix<T, N, N> operator*(const matrix<T, N, N> &, T);                \
+  PREFIX matrix<T, N, N> operator*(T, const matrix<T, N, N> &);                \
+  PREFIX matrix<T, N, N> operator*(const matrix<T, N, N> &,                    \
+                                   const matrix<T, N, N> &);                   \
+  PREFIX matrix<T, N, N> operator/(T, const matrix<T, N, N> &);                \
+  PREFIX matrix<T, N, N> operator/(const matrix<T, N, N> &,                    \
+                                   const matrix<T, N, N> &);
+
+#define COTILA_DETAIL_PRECOMPILED_ELIMINATION(PREFIX, T, N)                    \
+  PREFIX matrix<T, N, N> rref(const matrix<T, N, N> &);                        \
+  PREFIX T det(const matrix<T, N, N> &);                                       \
+  PREFIX matrix<T, N, N> inverse(const matrix<T, N, N> &);                     \
+  PREFIX std::optional<matrix<T, N, N>> try_inverse(const matrix<T, N, N> &);
+
+#define COTILA_DETAIL_PRECOMPILED_SIZES(X, PREFIX, T)                          \
+  X(PREFIX, T, 2)                                                              \
+  X(PREFIX, T, 3)                                                              \
+  X(PREFIX, T, 4)                                                              \
+  X(PREFIX, T, 5)                                                              \
+  X(PREFIX, T, 6)                                                              \
+  X(PREFIX, T, 7)                                                              \
+  X(PREFIX, T, 8)
+
+#define COTILA_DETAIL_PRECOMPILED(PREFIX)                                      \
+  namespace cotila {                                                           \
+  COTILA_DETAIL_PRECOMPILED_SIZES(COTILA_DETAIL_PRECOMPILED_ARITHMETIC,        \
+                                  PREFIX, float)                               \
+  COTILA_DETAIL_PRECOMPILED_SIZES(COTILA_DETAIL_PRECOMPILED_ARITHMETIC,        \
+                                  PREFIX, double)                              \
+  COTILA_DETAIL_PRECOMPILED_SIZES(COTILA_DETAIL_PRECOMPILED_ARITHMETIC,        \
+                                  PREFIX, std::complex<float>)                 \
+  COTILA_DETAIL_PRECOMPILED_SIZES(COTILA_DETAIL_PRECOMPILED_ARITHMETIC,        \
+                                  PREFIX, std::complex<double>)                \
+  COTILA_DETAIL_PRECOMPILED_SIZES(COTILA_DETAIL_PRECOMPILED_ELIMINATION,       \
+                                  PREFIX, float)                               \
+  COTILA_DETAIL_PRECOMPILED_SIZES(COTILA_DETAIL_PRECOMPILED_ELIMINATION,       \
+                                  PREFIX, double)                              \
+  COTILA_DETAIL_PRECOMPILED_SIZES(COTILA_DETAIL_PRECOMPILED_ELIMINATION,       \
+                                  PREFIX, std::complex<float>)                 \
+  COTILA_DETAIL_PRECOMPILED_SIZES(COTILA_DETAIL_PRECOMPILED_ELIMINATION,       \
+                                  PREFIX, std::complex<double>)                \
+  }
+
+#ifdef COTILA_PRECOMPILED
+COTILA_DETAIL_PRECOMPILED(extern template)
+#endif
+
+#endif // COTILA_DETAIL_PRECOMPILED_H_
@@ -9,3 +9,15 @@
 /** \defgroup matrix
  *  \brief Matrix operations (relating to the class cotila::matrix)
  */
+
+/** \defgroup polynomial
+ *  \brief Polynomial operations (relating to the class cotila::polynomial)
+ */
+
+/** \defgroup signal
+ *  \brief Signal processing operations
+ */
+
+/** \defgroup cost
+ *  \brief Compile-time cost model of operations
+ */
@@ -0,0 +1,138 @@
+/** @file
+ *  @brief Broadcasting operations between matrices and vectors.
+ */
+
+#ifndef COTILA_MATRIX_BROADCAST_H_
+#define COTILA_MATRIX_BROADCAST_H_
+
+#include <cotila/matrix/matrix.h>
+#include <cotila/vector/vector.h>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace cotila {
+
+/** @brief A vector tagged with the axis of a matrix it is broadcast along
+ *  @tparam A `axis::row` if the vector has an element per row, or
+ *  `axis::column` if it has an element per column
+ *  @tparam T scalar type
+ *  @tparam N size of the vector
+ *
+ *  Created by `cotila::along`, and used as an operand to the arithmetic
+ *  operators with a matrix.
+ */
+template <axis A, typename T, std::size_t N> struct axis_vector {
+  vector<T, N> v; ///< @brief the broadcast vector
+};
+
+/** \addtogroup matrix
+ *  @{
+ */
+
+/** @brief applies a function between a matrix and a broadcast vector
+ *  @tparam A `axis::row` to apply \f$ \textbf{v}_i \f$ to each element of
+ *  row i, or `axis::column` to apply \f$ \textbf{v}_j \f$ to each element of
+ *  column j
+ *  @param f a function of type F that operates on two scalars of type T and
+ *  returns a scalar of type U
+ *  @param m an \f$ M \times N \f$ matrix of type T
+ *  @param v an M-vector (for `axis::row`) or N-vector (for `axis::column`) of
+ *  type T
+ *  @return an \f$ M \times N \f$ matrix of type U with elements
+ *  \f$ f\left(\textbf{m}_{ij}, \textbf{v}_i\right) \f$ or
+ *  \f$ f\left(\textbf{m}_{ij}, \textbf{v}_j\right) \f$
+ *
+ *  Applies a function elementwise between a matrix and a vector repeated
+ *  along its rows or columns, in a single pass and without forming the
+ *  repeated matrix:
+ *  \code{.cpp}
+ *  // adds bias[j] to every element of column j
+ *  auto y = cotila::broadcast<cotila::axis::column>(std::plus<>(), x, bias);
+ *  \endcode
+ */
+template <axis A, typename F, typename T, std::size_t M, std::size_t N,
+          std::size_t K, typename U = std::invoke_result_t<F, T, T>>
+constexpr matrix<U, M, N> broadcast(F f, const matrix<T, M, N> &m,
+                                    const vector<T, K> &v) {
+  static_assert(K == (A == axis::row ? M : N),
+                "vector size must match the broadcast axis");
+  matrix<U, M, N> broadcasted = {};
+  for (std::size_t i = 0; i < M; ++i) {
+    for (std::size_t j = 0; j < N; ++j) {
+      if constexpr (A == axis::row)
+        broadcasted[i][j] = f(m[i][j], v[i]);
+      else
+        broadcasted[i][j] = f(m[i][j], v[j]);
+    }
+  }
+  return broadcasted;
+}
+
+/** @brief tags a vector for broadcasting
+ *  @tparam A `axis::row` if the vector has an element per row, or
+ *  `axis::column` if it has an element per column
+ *  @param v an N-vector of type T
+ *  @return `v` tagged with the axis A
+ *
+ *  Tags a vector so that it is broadcast by the arithmetic operators:
+ *  \code{.cpp}
+ *  // adds bias[j] to every element of column j
+ *  auto y = x + cotila::along<cotila::axis::column>(bias);
+ *  \endcode
+ */
+template <axis A, typename T, std::size_t N>
+constexpr axis_vector<A, T, N> along(const vector<T, N> &v) {
+  return {v};
+}
+
+/** @brief computes the sum of a matrix and a broadcast vector
+ *  @param m an \f$ M \times N \f$ matrix of type T
+ *  @param v a vector of type T tagged with an axis
+ *  @return \f$ \textbf{m} + \textbf{v} \f$, with `v` repeated along the axis
+ */
+template <axis A, typename T, std::size_t M, std::size_t N, std::size_t K>
+constexpr matrix<T, M, N> operator+(const matrix<T, M, N> &m,
+                                    const axis_vector<A, T, K> &v) {
+  return broadcast<A>(std::plus<T>(), m, v.v);
+}
+
+/** @brief computes the difference of a matrix and a broadcast vector
+ *  @param m an \f$ M \times N \f$ matrix of type T
+ *  @param v a vector of type T tagged with an axis
+ *  @return \f$ \textbf{m} - \textbf{v} \f$, with `v` repeated along the axis
+ */
+template <axis A, typename T, std::size_t M, std::size_t N, std::size_t K>
+constexpr matrix<T, M, N> operator-(const matrix<T, M, N> &m,
+                                    const axis_vector<A, T, K> &v) {
+  return broadcast<A>(std::minus<T>(), m, v.v);
+}
+
+/** @brief computes the elementwise product of a matrix and a broadcast vector
+ *  @param m an \f$ M \times N \f$ matrix of type T
+ *  @param v a vector of type T tagged with an axis
+ *  @return \f$ \textbf{m} \circ \textbf{v} \f$, with `v` repeated along the
+ *  axis
+ */
+template <axis A, typename T, std::size_t M, std::size_t N, std::size_t K>
+constexpr matrix<T, M, N> operator*(const matrix<T, M, N> &m,
+                                    const axis_vector<A, T, K> &v) {
+  return broadcast<A>(std::multiplies<T>(), m, v.v);
+}
+
+/** @brief computes the elementwise quotient of a matrix and a broadcast vector
+ *  @param m an \f$ M \times N \f$ matrix of type T
+ *  @param v a vector of type T tagged with an axis
+ *  @return \f$ \textbf{m} / \textbf{v} \f$, with `v` repeated along the axis
+ */
+template <axis A, typename T, std::size_t M, std::size_t N, std::size_t K>
+constexpr matrix<T, M, N> operator/(const matrix<T, M, N> &m,
+                                    const axis_vector<A, T, K> &v) {
+  return broadcast<A>(std::divides<T>(), m, v.v);
+}
+
+/** @}*/
+
+} // namespace cotila
+
+#endif // COTILA_MATRIX_BROADCAST_H_
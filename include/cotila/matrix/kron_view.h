@@ -0,0 +1,130 @@
+/** @file
+ *  @brief Contains the definition of the `cotila::kron_view` class.
+ */
+
+#ifndef COTILA_MATRIX_KRON_VIEW_H_
+#define COTILA_MATRIX_KRON_VIEW_H_
+
+#include <cotila/detail/complex.h>
+#include <cotila/matrix/math.h>
+#include <cotila/matrix/matrix.h>
+#include <cotila/matrix/utility.h>
+#include <cotila/vector/vector.h>
+#include <cstddef>
+
+namespace cotila {
+
+/** @brief A lazily evaluated kronecker tensor product
+ *  @tparam T scalar type of the factors
+ *  @tparam M number of rows of the first factor
+ *  @tparam N number of columns of the first factor
+ *  @tparam P number of rows of the second factor
+ *  @tparam Q number of columns of the second factor
+ *
+ *  `cotila::kron_view` represents the \f$ MP \times NQ \f$ matrix
+ *  \f$ \textbf{a}\otimes\textbf{b} \f$ by its factors.  Products with it are
+ *  computed without forming the kronecker product, which makes it suitable
+ *  for separable transforms:
+ *  \code{.cpp}
+ *  // Computes a X b^T for each N x Q image X, stored in row-major order in a
+ *  // column of z
+ *  auto y = cotila::matmul(cotila::kron_view(a, b), z);
+ *  \endcode
+ *  The view contains copies of the factors.  Use `cotila::kron` to form the
+ *  product.
+ */
+template <typename T, std::size_t M, std::size_t N, std::size_t P,
+          std::size_t Q>
+class kron_view {
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  static constexpr size_type column_size = M * P; ///< Number of rows
+  static constexpr size_type row_size = N * Q;    ///< Number of columns
+
+  /** @brief constructs a kronecker product
+   *  @param a an \f$M \times N\f$ matrix
+   *  @param b a \f$P \times Q\f$ matrix
+   */
+  constexpr kron_view(const matrix<T, M, N> &a, const matrix<T, P, Q> &b)
+      : a(a), b(b) {}
+
+  /** @brief returns the first factor
+   *  @return the \f$M \times N\f$ matrix \f$ \textbf{a} \f$
+   */
+  constexpr const matrix<T, M, N> &first() const { return a; }
+
+  /** @brief returns the second factor
+   *  @return the \f$P \times Q\f$ matrix \f$ \textbf{b} \f$
+   */
+  constexpr const matrix<T, P, Q> &second() const { return b; }
+
+  /** @brief access specified element
+   *  @param i index of the row
+   *  @param j index of the column
+   *  @return the element \f$ \left(\textbf{a}\otimes\textbf{b}\right)_{ij} \f$
+   */
+  constexpr T operator()(std::size_t i, std::size_t j) const {
+    return detail::mul(a[i / P][j / Q], b[i % P][j % Q]);
+  }
+
+private:
+  matrix<T, M, N> a;
+  matrix<T, P, Q> b;
+};
+
+/** \addtogroup matrix
+ *  @{
+ */
+
+/** @brief computes the matrix product with a kronecker product
+ *  @param k an \f$MP \times NQ\f$ kronecker product
+ *  @param z an \f$NQ \times R\f$ matrix
+ *  @return an \f$ MP \times R \f$ matrix \f$ \textbf{k}\textbf{z} \f$ of type T
+ *
+ *  Computes the product of a kronecker product with a matrix, without forming
+ *  the kronecker product.
+ */
+template <typename T, std::size_t M, std::size_t N, std::size_t P,
+          std::size_t Q, std::size_t R>
+constexpr matrix<T, M * P, R> matmul(const kron_view<T, M, N, P, Q> &k,
+                                     const matrix<T, N * Q, R> &z) {
+  return detail::kron_apply_impl(k.first(), k.second(), z);
+}
+
+/** @brief computes the matrix product with a kronecker product
+ *  @param z an \f$R \times MP\f$ matrix
+ *  @param k an \f$MP \times NQ\f$ kronecker product
+ *  @return an \f$ R \times NQ \f$ matrix \f$ \textbf{z}\textbf{k} \f$ of type T
+ *
+ *  Computes the product of a matrix with a kronecker product, without forming
+ *  the kronecker product.
+ */
+template <typename T, std::size_t M, std::size_t N, std::size_t P,
+          std::size_t Q, std::size_t R>
+constexpr matrix<T, R, N * Q> matmul(const matrix<T, R, M * P> &z,
+                                     const kron_view<T, M, N, P, Q> &k) {
+  return transpose(detail::kron_apply_impl(
+      transpose(k.first()), transpose(k.second()), transpose(z)));
+}
+
+/** @brief computes the product of a kronecker product and a vector
+ *  @param k an \f$MP \times NQ\f$ kronecker product
+ *  @param x an \f$NQ\f$-vector
+ *  @return an \f$MP\f$-vector \f$ \textbf{k}\textbf{x} \f$ of type T
+ *
+ *  Computes the product of a kronecker product with a vector, without forming
+ *  the kronecker product.
+ */
+template <typename T, std::size_t M, std::size_t N, std::size_t P,
+          std::size_t Q>
+constexpr vector<T, M * P> matvec(const kron_view<T, M, N, P, Q> &k,
+                                  const vector<T, N * Q> &x) {
+  return kron_apply(k.first(), k.second(), x);
+}
+
+/** @}*/
+
+} // namespace cotila
+
+#endif // COTILA_MATRIX_KRON_VIEW_H_
@@ -5,16 +5,192 @@
 #define COTILA_MATRIX_MATH_H_
 
 #include<algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
 
+#include <cotila/detail/complex.h>
 #include <cotila/scalar/math.h>
 #include <cotila/vector/vector.h>
 #include <cotila/vector/math.h>
 #include <cotila/matrix/matrix.h>
 #include <cotila/matrix/utility.h>
 #include <cotila/detail/assert.h>
+#include <cotila/detail/config.h>
+
+/** @brief Minimum matrix dimension for Strassen-Winograd multiplication
+ *  \ingroup matrix
+ *
+ *  `cotila::matmul` recursively applies the Strassen-Winograd algorithm while
+ *  all three dimensions of the product are larger than this value, and uses
+ *  the direct algorithm below it.  Define before including cotila to tune.
+ */
+#ifndef COTILA_STRASSEN_CUTOFF
+#define COTILA_STRASSEN_CUTOFF 128
+#endif
 
 namespace cotila {
 
+/// @private
+namespace detail {
+
+// Number of columns of the result computed per pass over the left operand in
+// the direct matrix multiplication kernel
+constexpr std::size_t matmul_block = 64;
+
+// Submatrix of a matrix with rows of type Row, starting at the given row and
+// column offset
+template <typename Row> struct matrix_view {
+  Row *rows;
+  std::size_t column;
+
+  constexpr auto &operator()(std::size_t i, std::size_t j) const {
+    return rows[i][column + j];
+  }
+
+  constexpr matrix_view block(std::size_t i, std::size_t j) const {
+    return {rows + i, column + j};
+  }
+};
+
+template <typename T, std::size_t M, std::size_t N>
+constexpr matrix_view<T[N]> make_view(matrix<T, M, N> &m) {
+  return {m.arrays, 0};
+}
+
+template <typename T, std::size_t M, std::size_t N>
+constexpr matrix_view<const T[N]> make_view(const matrix<T, M, N> &m) {
+  return {m.arrays, 0};
+}
+
+// c = ab, for an m x n matrix a and an n x p matrix b.  Each element of c is
+// accumulated in order of k, but the inner loop runs along rows of b and c.
+template <typename A, typename B, typename C>
+constexpr void matmul_kernel(A a, B b, C c, std::size_t m, std::size_t n,
+                             std::size_t p) {
+  using T = std::remove_reference_t<decltype(c(0, 0))>;
+  for (std::size_t jb = 0; jb < p; jb += matmul_block) {
+    std::size_t je = std::min(p, jb + matmul_block);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = jb; j < je; ++j)
+        c(i, j) = T();
+      for (std::size_t k = 0; k < n; ++k) {
+        auto aik = a(i, k);
+        for (std::size_t j = jb; j < je; ++j)
+          c(i, j) = add(c(i, j), mul(aik, b(k, j)));
+      }
+    }
+  }
+}
+
+// c = a + b and c = a - b, for m x n matrices
+template <typename C, typename A, typename B>
+constexpr void view_add(C c, A a, B b, std::size_t m, std::size_t n) {
+  for (std::size_t i = 0; i < m; ++i)
+    for (std::size_t j = 0; j < n; ++j)
+      c(i, j) = add(a(i, j), b(i, j));
+}
+
+template <typename C, typename A, typename B>
+constexpr void view_sub(C c, A a, B b, std::size_t m, std::size_t n) {
+  for (std::size_t i = 0; i < m; ++i)
+    for (std::size_t j = 0; j < n; ++j)
+      c(i, j) = sub(a(i, j), b(i, j));
+}
+
+// c = ab with the Strassen-Winograd algorithm, using the schedule of Boyer,
+// Dumas, Pernet and Zhou that needs only two temporaries: x, with at least
+// m/2 rows and max(n, p)/2 columns, and y, with at least n/2 rows and p/2
+// columns.  Recursive calls use the rows of x and y after those.  Odd
+// dimensions are handled by peeling the last row or column and fixing up the
+// result afterwards.
+template <std::size_t Cutoff, typename A, typename B, typename C, typename X,
+          typename Y>
+constexpr void winograd(A a, B b, C c, std::size_t m, std::size_t n,
+                        std::size_t p, X x, Y y) {
+  using T = std::remove_reference_t<decltype(c(0, 0))>;
+  if (m <= Cutoff || n <= Cutoff || p <= Cutoff) {
+    matmul_kernel(a, b, c, m, n, p);
+    return;
+  }
+
+  const std::size_t m2 = m / 2, n2 = n / 2, p2 = p / 2;
+  auto a11 = a, a12 = a.block(0, n2), a21 = a.block(m2, 0),
+       a22 = a.block(m2, n2);
+  auto b11 = b, b12 = b.block(0, p2), b21 = b.block(n2, 0),
+       b22 = b.block(n2, p2);
+  auto c11 = c, c12 = c.block(0, p2), c21 = c.block(m2, 0),
+       c22 = c.block(m2, p2);
+  auto xr = x.block(m2, 0), yr = y.block(n2, 0);
+
+  view_sub(x, a11, a21, m2, n2);                 // S3 = A11 - A21
+  view_sub(y, b22, b12, n2, p2);                 // T3 = B22 - B12
+  winograd<Cutoff>(x, y, c21, m2, n2, p2, xr, yr); // P7 = S3 T3
+  view_add(x, a21, a22, m2, n2);                 // S1 = A21 + A22
+  view_sub(y, b12, b11, n2, p2);                 // T1 = B12 - B11
+  winograd<Cutoff>(x, y, c22, m2, n2, p2, xr, yr); // P5 = S1 T1
+  view_sub(x, x, a11, m2, n2);                   // S2 = S1 - A11
+  view_sub(y, b22, y, n2, p2);                   // T2 = B22 - T1
+  winograd<Cutoff>(x, y, c12, m2, n2, p2, xr, yr); // P6 = S2 T2
+  view_sub(x, a12, x, m2, n2);                   // S4 = A12 - S2
+  winograd<Cutoff>(x, b22, c11, m2, n2, p2, xr, yr); // P3 = S4 B22
+  winograd<Cutoff>(a11, b11, x, m2, n2, p2, xr, yr); // P1 = A11 B11
+  view_add(c12, x, c12, m2, p2);                 // U2 = P1 + P6
+  view_add(c21, c12, c21, m2, p2);               // U3 = U2 + P7
+  view_add(c12, c12, c22, m2, p2);               // U4 = U2 + P5
+  view_add(c22, c21, c22, m2, p2);               // C22 = U3 + P5
+  view_add(c12, c12, c11, m2, p2);               // C12 = U4 + P3
+  view_sub(y, y, b21, n2, p2);                   // T4 = T2 - B21
+  winograd<Cutoff>(a22, y, c11, m2, n2, p2, xr, yr); // P4 = A22 T4
+  view_sub(c21, c21, c11, m2, p2);               // C21 = U3 - P4
+  winograd<Cutoff>(a12, b21, c11, m2, n2, p2, xr, yr); // P2 = A12 B21
+  view_add(c11, x, c11, m2, p2);                 // C11 = P1 + P2
+
+  // Peeled inner dimension
+  if (n % 2)
+    for (std::size_t i = 0; i < 2 * m2; ++i)
+      for (std::size_t j = 0; j < 2 * p2; ++j)
+        c(i, j) = add(c(i, j), mul(a(i, n - 1), b(n - 1, j)));
+
+  // Peeled last column and row of the result
+  if (p % 2) {
+    for (std::size_t i = 0; i < m; ++i) {
+      c(i, p - 1) = T();
+      for (std::size_t k = 0; k < n; ++k)
+        c(i, p - 1) = add(c(i, p - 1), mul(a(i, k), b(k, p - 1)));
+    }
+  }
+  if (m % 2) {
+    for (std::size_t j = 0; j < 2 * p2; ++j) {
+      c(m - 1, j) = T();
+      for (std::size_t k = 0; k < n; ++k)
+        c(m - 1, j) = add(c(m - 1, j), mul(a(m - 1, k), b(k, j)));
+    }
+  }
+}
+
+template <std::size_t Cutoff, typename T, std::size_t M, std::size_t N,
+          std::size_t P>
+constexpr matrix<T, M, P> matmul_impl(const matrix<T, M, N> &a,
+                                      const matrix<T, N, P> &b) {
+  static_assert(Cutoff > 0, "Strassen-Winograd cutoff must be positive");
+  matrix<T, M, P> c = {};
+  if constexpr (M > Cutoff && N > Cutoff && P > Cutoff) {
+    // Temporaries for every level of recursion
+    matrix<T, M, std::max(N, P) / 2> x = {};
+    matrix<T, N, P / 2> y = {};
+    winograd<Cutoff>(make_view(a), make_view(b), make_view(c), M, N, P,
+                     make_view(x), make_view(y));
+  } else {
+    matmul_kernel(make_view(a), make_view(b), make_view(c), M, N, P);
+  }
+  return c;
+}
+
+} // namespace detail
+
 /** \addtogroup matrix
  *  @{
  */
@@ -87,12 +263,388 @@ constexpr matrix<T, N, M> hermitian(const matrix<T, M, N> &m) {
  *  @return an \f$ M \times P \f$ matrix \f$ \textbf{a}\textbf{b} \f$ of type T such that
  *  \f$ \left(\textbf{ab}\right)_{ij} = \sum\limits_{k=1}^{N}\textbf{a}_{ik}\textbf{b}_{kj} \f$
  *
- *  Computes the product of two matrices.
+ *  Computes the product of two matrices.  When M, N and P are all larger than
+ *  `COTILA_STRASSEN_CUTOFF`, the Strassen-Winograd algorithm is applied
+ *  recursively until the blocks are small enough for the direct algorithm.
+ *  This requires temporary storage about the size of the result, and rounding
+ *  errors may be slightly larger than with the direct algorithm.
  */
 template <typename T, std::size_t M, std::size_t N, std::size_t P>
 constexpr matrix<T, M, P> matmul(const matrix<T, M, N> &a,
                                  const matrix<T, N, P> &b) {
-  return generate<M, P>([&a, &b](auto i, auto j){return cotila::sum(a.row(i)*b.column(j));});
+  return detail::matmul_impl<COTILA_STRASSEN_CUTOFF>(a, b);
+}
+
+/// @private
+namespace detail {
+
+// split[i][j] is the index of the last matrix in the left factor of the
+// cheapest product of matrices i through j
+template <std::size_t K> struct matrix_chain {
+  std::size_t split[K][K];
+};
+
+// Dynamic programming over a chain of K matrices with dimensions
+// dims[0] x dims[1], dims[1] x dims[2], ...
+template <std::size_t K>
+constexpr matrix_chain<K> matrix_chain_order(const std::size_t (&dims)[K + 1]) {
+  matrix_chain<K> chain = {};
+  unsigned long long cost[K][K] = {};
+  for (std::size_t length = 2; length <= K; ++length) {
+    for (std::size_t i = 0; i + length <= K; ++i) {
+      std::size_t j = i + length - 1;
+      for (std::size_t s = i; s < j; ++s) {
+        unsigned long long c = cost[i][s] + cost[s + 1][j] +
+                               static_cast<unsigned long long>(dims[i]) *
+                                   dims[s + 1] * dims[j + 1];
+        if (s == i || c < cost[i][j]) {
+          cost[i][j] = c;
+          chain.split[i][j] = s;
+        }
+      }
+    }
+  }
+  return chain;
+}
+
+template <typename First, typename... Matrices>
+inline constexpr matrix_chain<1 + sizeof...(Matrices)> matrix_chain_v =
+    matrix_chain_order<1 + sizeof...(Matrices)>(
+        {First::column_size, First::row_size, Matrices::row_size...});
+
+template <std::size_t I, std::size_t J, typename... Matrices>
+constexpr decltype(auto)
+multi_matmul_impl(const std::tuple<const Matrices &...> &matrices) {
+  if constexpr (I == J) {
+    return std::get<I>(matrices);
+  } else {
+    constexpr std::size_t S = matrix_chain_v<Matrices...>.split[I][J];
+    return matmul(multi_matmul_impl<I, S>(matrices),
+                  multi_matmul_impl<S + 1, J>(matrices));
+  }
+}
+
+} // namespace detail
+
+/** @brief computes the product of a chain of matrices
+ *  @param matrices matrices of type T with dimensions \f$ M_0 \times M_1 \f$,
+ *  \f$ M_1 \times M_2 \f$, ...
+ *  @return the \f$ M_0 \times M_K \f$ matrix product of all arguments, in order
+ *
+ *  Computes the product of a chain of matrices.  Since matrix multiplication
+ *  is associative, the multiplications are evaluated in the order requiring
+ *  the fewest scalar multiplications, which is found at compile time from the
+ *  dimensions of the matrices.
+ */
+template <typename... Matrices>
+constexpr auto multi_matmul(const Matrices &... matrices) {
+  static_assert(sizeof...(Matrices) > 0, "at least one matrix is required");
+  return detail::multi_matmul_impl<0, sizeof...(Matrices) - 1>(
+      std::tuple<const Matrices &...>(matrices...));
+}
+
+/** @brief computes the matrix-vector product
+ *  @param a an \f$M \times N\f$ matrix of type T
+ *  @param x an N-vector of type T
+ *  @return an M-vector \f$ \textbf{a}\textbf{x} \f$ of type T such that
+ *  \f$ \left(\textbf{ax}\right)_i = \sum\limits_{j=1}^{N}\textbf{a}_{ij}\textbf{x}_j \f$
+ *
+ *  Computes the product of a matrix and a column vector, as a dot product of
+ *  each row with the vector.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr vector<T, M> matvec(const matrix<T, M, N> &a, const vector<T, N> &x) {
+  vector<T, M> y = {};
+  for (std::size_t i = 0; i < M; ++i) {
+    T r = {};
+    for (std::size_t j = 0; j < N; ++j)
+      r = detail::add(r, detail::mul(a[i][j], x[j]));
+    y[i] = r;
+  }
+  return y;
+}
+
+/** @brief computes the transposed matrix-vector product
+ *  @param a an \f$M \times N\f$ matrix of type T
+ *  @param x an M-vector of type T
+ *  @return an N-vector \f$ \textbf{a}^{\mathrm{T}}\textbf{x} \f$ of type T such that
+ *  \f$ \left(\textbf{a}^{\mathrm{T}}\textbf{x}\right)_j = \sum\limits_{i=1}^{M}\textbf{a}_{ij}\textbf{x}_i \f$
+ *
+ *  Computes the product of the transpose of a matrix and a column vector,
+ *  without forming the transpose.  The rows of the matrix are accumulated in
+ *  order, so the matrix is traversed contiguously.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr vector<T, N> matvec_t(const matrix<T, M, N> &a,
+                                const vector<T, M> &x) {
+  vector<T, N> y = {};
+  for (std::size_t i = 0; i < M; ++i) {
+    const T s = x[i];
+    for (std::size_t j = 0; j < N; ++j)
+      y[j] = detail::add(y[j], detail::mul(a[i][j], s));
+  }
+  return y;
+}
+
+/** @brief computes the Hermitian matrix-vector product
+ *  @param a an \f$M \times N\f$ matrix of type T
+ *  @param x an M-vector of type T
+ *  @return an N-vector \f$ \textbf{a}^{*}\textbf{x} \f$ of type T such that
+ *  \f$ \left(\textbf{a}^{*}\textbf{x}\right)_j = \sum\limits_{i=1}^{M}\overline{\textbf{a}_{ij}}\textbf{x}_i \f$
+ *
+ *  Computes the product of the Hermitian (conjugate) transpose of a matrix and
+ *  a column vector, without forming the transpose.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr vector<T, N> matvec_h(const matrix<T, M, N> &a,
+                                const vector<T, M> &x) {
+  vector<T, N> y = {};
+  for (std::size_t i = 0; i < M; ++i) {
+    const T s = x[i];
+    for (std::size_t j = 0; j < N; ++j)
+      y[j] = detail::add(y[j], detail::mul(cotila::conj(a[i][j]), s));
+  }
+  return y;
+}
+
+/** @brief computes the vector-matrix product
+ *  @param x an M-vector of type T
+ *  @param a an \f$M \times N\f$ matrix of type T
+ *  @return an N-vector \f$ \textbf{x}^{\mathrm{T}}\textbf{a} \f$ of type T such that
+ *  \f$ \left(\textbf{x}^{\mathrm{T}}\textbf{a}\right)_j = \sum\limits_{i=1}^{M}\textbf{x}_i\textbf{a}_{ij} \f$
+ *
+ *  Computes the product of a row vector and a matrix.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr vector<T, N> vecmat(const vector<T, M> &x, const matrix<T, M, N> &a) {
+  return matvec_t(a, x);
+}
+
+/** @brief computes the generalized matrix-vector product
+ *  @param alpha a scalar of type T
+ *  @param a an \f$M \times N\f$ matrix of type T
+ *  @param x an N-vector of type T
+ *  @param beta a scalar of type T
+ *  @param y an M-vector of type T
+ *  @return an M-vector \f$ \alpha\textbf{a}\textbf{x} + \beta\textbf{y} \f$ of type T
+ *
+ *  Computes a scaled matrix-vector product plus a scaled vector in a single
+ *  pass over the matrix, as in the BLAS routine `gemv`.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr vector<T, M> gemv(T alpha, const matrix<T, M, N> &a,
+                            const vector<T, N> &x, T beta,
+                            const vector<T, M> &y) {
+  vector<T, M> r = {};
+  for (std::size_t i = 0; i < M; ++i) {
+    T s = {};
+    for (std::size_t j = 0; j < N; ++j)
+      s = detail::add(s, detail::mul(a[i][j], x[j]));
+    r[i] = detail::add(detail::mul(alpha, s), detail::mul(beta, y[i]));
+  }
+  return r;
+}
+
+/** @brief computes the outer product
+ *  @param a an M-vector of type T
+ *  @param b an N-vector of type T
+ *  @return an \f$ M \times N \f$ matrix \f$ \textbf{a}\textbf{b}^{\mathrm{T}} \f$ of type T such that
+ *  \f$ \left(\textbf{a}\textbf{b}^{\mathrm{T}}\right)_{ij} = \textbf{a}_i\textbf{b}_j \f$
+ *
+ *  Computes the outer product of two vectors.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr matrix<T, M, N> outer(const vector<T, M> &a, const vector<T, N> &b) {
+  matrix<T, M, N> product = {};
+  for (std::size_t i = 0; i < M; ++i)
+    for (std::size_t j = 0; j < N; ++j)
+      product[i][j] = detail::mul(a[i], b[j]);
+  return product;
+}
+
+/** @brief performs a rank-1 update
+ *  @param a an \f$ M \times N \f$ matrix of type T, updated in place
+ *  @param alpha a scalar of type T
+ *  @param x an M-vector of type T
+ *  @param y an N-vector of type T
+ *
+ *  Updates a matrix in place with a scaled outer product,
+ *  \f$ \textbf{a} \leftarrow \textbf{a} + \alpha\textbf{x}\textbf{y}^{\mathrm{T}} \f$,
+ *  as in the BLAS routine `ger`.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr void ger(matrix<T, M, N> &a, T alpha, const vector<T, M> &x,
+                   const vector<T, N> &y) {
+  for (std::size_t i = 0; i < M; ++i) {
+    const T s = detail::mul(alpha, x[i]);
+    for (std::size_t j = 0; j < N; ++j)
+      a[i][j] = detail::add(a[i][j], detail::mul(s, y[j]));
+  }
+}
+
+/** @brief computes the symmetric product of a matrix with its transpose
+ *  @param a an \f$ M \times N \f$ matrix of type T
+ *  @return an \f$ M \times M \f$ matrix \f$ \textbf{a}\textbf{a}^{\mathrm{T}} \f$ of type T
+ *
+ *  Computes \f$ \textbf{a}\textbf{a}^{\mathrm{T}} \f$, as in the BLAS routine
+ *  `syrk`.  Only the lower triangle is computed, as dot products between rows,
+ *  and it is mirrored into the upper triangle.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr matrix<T, M, M> syrk(const matrix<T, M, N> &a) {
+  matrix<T, M, M> product = {};
+  for (std::size_t i = 0; i < M; ++i) {
+    for (std::size_t j = 0; j <= i; ++j) {
+      T s = {};
+      for (std::size_t k = 0; k < N; ++k)
+        s = detail::add(s, detail::mul(a[i][k], a[j][k]));
+      product[i][j] = s;
+      product[j][i] = s;
+    }
+  }
+  return product;
+}
+
+/** @brief computes the symmetric product of a matrix transpose with the matrix
+ *  @param a an \f$ M \times N \f$ matrix of type T
+ *  @return an \f$ N \times N \f$ matrix \f$ \textbf{a}^{\mathrm{T}}\textbf{a} \f$ of type T
+ *
+ *  Computes \f$ \textbf{a}^{\mathrm{T}}\textbf{a} \f$ without forming the
+ *  transpose.  Only the upper triangle is computed, by accumulating rank-1
+ *  updates from each row, and it is mirrored into the lower triangle.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr matrix<T, N, N> syrk_t(const matrix<T, M, N> &a) {
+  matrix<T, N, N> product = {};
+  for (std::size_t k = 0; k < M; ++k) {
+    for (std::size_t i = 0; i < N; ++i) {
+      const T s = a[k][i];
+      for (std::size_t j = i; j < N; ++j)
+        product[i][j] = detail::add(product[i][j], detail::mul(s, a[k][j]));
+    }
+  }
+  for (std::size_t i = 0; i < N; ++i)
+    for (std::size_t j = 0; j < i; ++j)
+      product[i][j] = product[j][i];
+  return product;
+}
+
+/// @private
+namespace detail {
+
+// Number of points transformed together, so that the product is computed
+// with contiguous loops across points rather than within a single point
+constexpr std::size_t transform_block = 16;
+
+// Transforms points through load(p, j) and store(p, i, value).  If Affine, the
+// last column of m is a translation applied to points with N - 1 elements.
+template <bool Affine, typename T, std::size_t M, std::size_t N,
+          typename Load, typename Store>
+constexpr void transform_impl(const matrix<T, M, N> &m, std::size_t count,
+                              Load &&load, Store &&store) {
+  constexpr std::size_t P = Affine ? N - 1 : N;
+  for (std::size_t first = 0; first < count; first += transform_block) {
+    std::size_t block =
+        count - first < transform_block ? count - first : transform_block;
+    T x[P][transform_block] = {};
+    for (std::size_t p = 0; p < block; ++p)
+      for (std::size_t j = 0; j < P; ++j)
+        x[j][p] = load(first + p, j);
+    for (std::size_t i = 0; i < M; ++i) {
+      T y[transform_block] = {};
+      if constexpr (Affine)
+        for (std::size_t p = 0; p < transform_block; ++p)
+          y[p] = m[i][N - 1];
+      for (std::size_t j = 0; j < P; ++j) {
+        const T a = m[i][j];
+        for (std::size_t p = 0; p < transform_block; ++p)
+          y[p] = add(y[p], mul(a, x[j][p]));
+      }
+      for (std::size_t p = 0; p < block; ++p)
+        store(first + p, i, y[p]);
+    }
+  }
+}
+
+} // namespace detail
+
+/** @brief transforms a buffer of points by a matrix
+ *  @param m an \f$ M \times N \f$ matrix of type T
+ *  @param in pointer to `count` N-vectors of type T
+ *  @param out pointer to `count` M-vectors of type T
+ *  @param count the number of points
+ *
+ *  Computes \f$ \textbf{m}\textbf{x} \f$ for each point \f$ \textbf{x} \f$ in
+ *  `in`, writing the results to `out`.  Points are transformed in blocks, with
+ *  each element of the product computed across the block.  `in` and `out`
+ *  must not overlap.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr void transform(const matrix<T, M, N> &m, const vector<T, N> *in,
+                         vector<T, M> *out, std::size_t count) {
+  detail::transform_impl<false>(
+      m, count, [in](std::size_t p, std::size_t j) { return in[p][j]; },
+      [out](std::size_t p, std::size_t i, T y) { out[p][i] = y; });
+}
+
+/** @brief transforms a buffer of interleaved points by a matrix
+ *  @param m an \f$ M \times N \f$ matrix of type T
+ *  @param in pointer to `count` points of N interleaved elements of type T
+ *  @param out pointer to `count` points of M interleaved elements of type T
+ *  @param count the number of points
+ *
+ *  Computes \f$ \textbf{m}\textbf{x} \f$ for each point \f$ \textbf{x} \f$ in
+ *  `in`, writing the results to `out`.  `in` and `out` must not overlap.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr void transform(const matrix<T, M, N> &m, const T *in, T *out,
+                         std::size_t count) {
+  detail::transform_impl<false>(
+      m, count, [in](std::size_t p, std::size_t j) { return in[p * N + j]; },
+      [out](std::size_t p, std::size_t i, T y) { out[p * M + i] = y; });
+}
+
+/** @brief transforms a buffer of points by an affine matrix
+ *  @param m an \f$ M \times \left(N + 1\right) \f$ matrix of type T
+ *  @param in pointer to `count` N-vectors of type T
+ *  @param out pointer to `count` M-vectors of type T
+ *  @param count the number of points
+ *
+ *  Computes \f$ \textbf{m} \begin{bmatrix} \textbf{x} \\ 1 \end{bmatrix} \f$
+ *  for each point \f$ \textbf{x} \f$ in `in`, writing the results to `out`.
+ *  The last column of `m` is the translation, so a \f$ 3 \times 4 \f$ matrix
+ *  transforms 3-D points to 3-D points and a \f$ 4 \times 4 \f$ matrix
+ *  transforms 3-D points to homogeneous coordinates.  `in` and `out` must not
+ *  overlap.
+ */
+template <typename T, std::size_t M, std::size_t N, std::size_t P>
+constexpr void transform_affine(const matrix<T, M, N> &m,
+                                const vector<T, P> *in, vector<T, M> *out,
+                                std::size_t count) {
+  static_assert(N == P + 1, "affine matrix must have one more column than the points");
+  detail::transform_impl<true>(
+      m, count, [in](std::size_t p, std::size_t j) { return in[p][j]; },
+      [out](std::size_t p, std::size_t i, T y) { out[p][i] = y; });
+}
+
+/** @brief transforms a buffer of interleaved points by an affine matrix
+ *  @param m an \f$ M \times \left(N + 1\right) \f$ matrix of type T
+ *  @param in pointer to `count` points of N interleaved elements of type T
+ *  @param out pointer to `count` points of M interleaved elements of type T
+ *  @param count the number of points
+ *
+ *  Computes \f$ \textbf{m} \begin{bmatrix} \textbf{x} \\ 1 \end{bmatrix} \f$
+ *  for each point \f$ \textbf{x} \f$ in `in`, writing the results to `out`.
+ *  `in` and `out` must not overlap.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr void transform_affine(const matrix<T, M, N> &m, const T *in, T *out,
+                                std::size_t count) {
+  static_assert(N > 1, "affine matrix must have at least two columns");
+  detail::transform_impl<true>(
+      m, count,
+      [in](std::size_t p, std::size_t j) { return in[p * (N - 1) + j]; },
+      [out](std::size_t p, std::size_t i, T y) { out[p * M + i] = y; });
 }
 
 /** @brief Computes the kronecker tensor product
@@ -108,61 +660,295 @@ template <typename T, std::size_t M, std::size_t N,
                       std::size_t P, std::size_t Q>
 constexpr matrix<T, M * P, N * Q> kron(const matrix<T, M, N> &a,
                                        const matrix<T, P, Q> &b) {
-  return generate<M * P, N * Q>([&a, &b](auto i, auto j) { return a[i / P][j / Q] * b[i % P][j % Q]; });
+  return generate<M * P, N * Q>([&a, &b](auto i, auto j) { return detail::mul(a[i / P][j / Q], b[i % P][j % Q]); });
+}
+
+/// @private
+namespace detail {
+
+// (a ⊗ b) z for an NQ x R matrix z, without forming the Kronecker product.
+// Each block row of z is transformed by whichever of a and b makes the total
+// number of multiplications smaller, then by the other.
+template <typename T, std::size_t M, std::size_t N, std::size_t P,
+          std::size_t Q, std::size_t R>
+constexpr matrix<T, M * P, R> kron_apply_impl(const matrix<T, M, N> &a,
+                                              const matrix<T, P, Q> &b,
+                                              const matrix<T, N * Q, R> &z) {
+  matrix<T, M * P, R> y = {};
+  if constexpr (N * P * (Q + M) <= M * Q * (N + P)) {
+    // w_j = b z_j
+    matrix<T, N * P, R> w = {};
+    for (std::size_t j = 0; j < N; ++j)
+      for (std::size_t k = 0; k < P; ++k)
+        for (std::size_t l = 0; l < Q; ++l) {
+          auto bkl = b[k][l];
+          for (std::size_t r = 0; r < R; ++r)
+            w[j * P + k][r] =
+                add(w[j * P + k][r], mul(bkl, z[j * Q + l][r]));
+        }
+    // y_i = sum_j a_ij w_j
+    for (std::size_t i = 0; i < M; ++i)
+      for (std::size_t j = 0; j < N; ++j) {
+        auto aij = a[i][j];
+        for (std::size_t k = 0; k < P; ++k)
+          for (std::size_t r = 0; r < R; ++r)
+            y[i * P + k][r] =
+                add(y[i * P + k][r], mul(aij, w[j * P + k][r]));
+      }
+  } else {
+    // v_i = sum_j a_ij z_j
+    matrix<T, M * Q, R> v = {};
+    for (std::size_t i = 0; i < M; ++i)
+      for (std::size_t j = 0; j < N; ++j) {
+        auto aij = a[i][j];
+        for (std::size_t l = 0; l < Q; ++l)
+          for (std::size_t r = 0; r < R; ++r)
+            v[i * Q + l][r] =
+                add(v[i * Q + l][r], mul(aij, z[j * Q + l][r]));
+      }
+    // y_i = b v_i
+    for (std::size_t i = 0; i < M; ++i)
+      for (std::size_t k = 0; k < P; ++k)
+        for (std::size_t l = 0; l < Q; ++l) {
+          auto bkl = b[k][l];
+          for (std::size_t r = 0; r < R; ++r)
+            y[i * P + k][r] =
+                add(y[i * P + k][r], mul(bkl, v[i * Q + l][r]));
+        }
+  }
+  return y;
+}
+
+} // namespace detail
+
+/** @brief Applies a kronecker tensor product to a vector
+ *  @param a an \f$M \times N\f$ matrix
+ *  @param b a \f$P \times Q\f$ matrix
+ *  @param x an \f$NQ\f$-vector
+ *  @return an \f$MP\f$-vector \f$ \left(\textbf{a}\otimes\textbf{b}\right)\textbf{x} \f$ of type T
+ *
+ *  Computes the product of the kronecker tensor product of two matrices with a
+ *  vector, without forming the \f$ MP \times NQ \f$ product.  If
+ *  \f$ \textbf{X} \f$ is `x` reshaped to an \f$ N \times Q \f$ matrix, the
+ *  result is \f$ \textbf{a}\textbf{X}\textbf{b}^T \f$ reshaped to an
+ *  \f$MP\f$-vector, which requires at most \f$ \min\left(NP(M+Q), MQ(N+P)\right) \f$
+ *  multiplications rather than \f$ MNPQ \f$.
+ */
+template <typename T, std::size_t M, std::size_t N, std::size_t P,
+          std::size_t Q>
+constexpr vector<T, M * P> kron_apply(const matrix<T, M, N> &a,
+                                      const matrix<T, P, Q> &b,
+                                      const vector<T, N * Q> &x) {
+  auto y = detail::kron_apply_impl(a, b, as_column(x));
+  return generate<M * P>([&y](std::size_t i) { return y[i][0]; });
+}
+
+/// @private
+namespace detail {
+
+// Reduces each row (axis::row) or column (axis::column) of m, combining the
+// mapped elements from first to last.  Columns are reduced by combining whole
+// rows into a vector of accumulators, so m is traversed in storage order.
+template <axis A, typename Map, typename Combine, typename T, std::size_t M,
+          std::size_t N>
+constexpr auto reduce_axis(const matrix<T, M, N> &m, Map map,
+                           Combine combine) {
+  using U = std::invoke_result_t<Map, T>;
+  if constexpr (A == axis::row) {
+    vector<U, M> reduced = {};
+    for (std::size_t i = 0; i < M; ++i) {
+      U x = map(m[i][0]);
+      for (std::size_t j = 1; j < N; ++j)
+        x = combine(x, map(m[i][j]));
+      reduced[i] = x;
+    }
+    return reduced;
+  } else {
+    vector<U, N> reduced = {};
+    for (std::size_t j = 0; j < N; ++j)
+      reduced[j] = map(m[0][j]);
+    for (std::size_t i = 1; i < M; ++i)
+      for (std::size_t j = 0; j < N; ++j)
+        reduced[j] = combine(reduced[j], map(m[i][j]));
+    return reduced;
+  }
+}
+
+template <typename T> constexpr T identity_map(const T &x) { return x; }
+
+template <typename T> constexpr T add_combine(const T &a, const T &b) {
+  return add(a, b);
+}
+
+template <typename T> constexpr T min_combine(const T &a, const T &b) {
+  return std::min(a, b);
+}
+
+template <typename T> constexpr T max_combine(const T &a, const T &b) {
+  return std::max(a, b);
+}
+
+} // namespace detail
+
+/** @brief computes the sums of each row or column
+ *  @tparam A `axis::row` to sum each row, or `axis::column` to sum each column
+ *  @param m an \f$ M \times N \f$ matrix of type T
+ *  @return an M-vector of row sums \f$ \sum\limits_{j} \textbf{m}_{ij} \f$,
+ *  or an N-vector of column sums \f$ \sum\limits_{i} \textbf{m}_{ij} \f$, of
+ *  type T
+ *
+ *  Computes the sum of the elements of each row or column of a matrix.
+ */
+template <axis A, typename T, std::size_t M, std::size_t N>
+constexpr vector<T, A == axis::row ? M : N> sum(const matrix<T, M, N> &m) {
+  return detail::reduce_axis<A>(m, detail::identity_map<T>,
+                                detail::add_combine<T>);
+}
+
+/** @brief computes the minimum of each row or column
+ *  @tparam A `axis::row` for the minimum of each row, or `axis::column` for
+ *  the minimum of each column
+ *  @param m an \f$ M \times N \f$ matrix of real type T
+ *  @return an M-vector of row minimums or an N-vector of column minimums, of
+ *  type T
+ *
+ *  Computes the minimum valued element of each row or column of a matrix.
+ */
+template <axis A, typename T, std::size_t M, std::size_t N>
+constexpr vector<T, A == axis::row ? M : N> min(const matrix<T, M, N> &m) {
+  COTILA_DETAIL_ASSERT_REAL(T)
+  return detail::reduce_axis<A>(m, detail::identity_map<T>,
+                                detail::min_combine<T>);
+}
+
+/** @brief computes the maximum of each row or column
+ *  @tparam A `axis::row` for the maximum of each row, or `axis::column` for
+ *  the maximum of each column
+ *  @param m an \f$ M \times N \f$ matrix of real type T
+ *  @return an M-vector of row maximums or an N-vector of column maximums, of
+ *  type T
+ *
+ *  Computes the maximum valued element of each row or column of a matrix.
+ */
+template <axis A, typename T, std::size_t M, std::size_t N>
+constexpr vector<T, A == axis::row ? M : N> max(const matrix<T, M, N> &m) {
+  COTILA_DETAIL_ASSERT_REAL(T)
+  return detail::reduce_axis<A>(m, detail::identity_map<T>,
+                                detail::max_combine<T>);
+}
+
+/** @brief computes the Euclidean norms of each row or column
+ *  @tparam A `axis::row` for the norm of each row, or `axis::column` for the
+ *  norm of each column
+ *  @param m an \f$ M \times N \f$ matrix of floating point type T
+ *  @return an M-vector of row norms
+ *  \f$ \sqrt{\sum\limits_{j} \lvert \textbf{m}_{ij} \rvert^2} \f$, or an
+ *  N-vector of column norms
+ *  \f$ \sqrt{\sum\limits_{i} \lvert \textbf{m}_{ij} \rvert^2} \f$, of the real
+ *  type of T
+ *
+ *  Computes the Euclidean norm of each row or column of a matrix.
+ */
+template <axis A, typename T, std::size_t M, std::size_t N>
+constexpr vector<detail::remove_complex_t<T>, A == axis::row ? M : N>
+norm(const matrix<T, M, N> &m) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  using R = detail::remove_complex_t<T>;
+  return sqrt(detail::reduce_axis<A>(m, detail::abs2<T>,
+                                     detail::add_combine<R>));
+}
+
+/** @brief computes the means of each row or column
+ *  @tparam A `axis::row` for the mean of each row, or `axis::column` for the
+ *  mean of each column
+ *  @param m an \f$ M \times N \f$ matrix of floating point type T
+ *  @return an M-vector of row means or an N-vector of column means, of type T
+ *
+ *  Computes the arithmetic mean of each row or column of a matrix.
+ */
+template <axis A, typename T, std::size_t M, std::size_t N>
+constexpr vector<T, A == axis::row ? M : N> mean(const matrix<T, M, N> &m) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  constexpr detail::remove_complex_t<T> s = A == axis::row ? N : M;
+  return elementwise([](const T &x) { return detail::scale(x, 1 / s); },
+                     sum<A>(m));
 }
 
 /** @brief Computes the maximum absolute column sum norm
  *  @param m an \f$M \times N\f$ matrix
- *  @return a scalar \f$ {\left\lVert \textbf{m} \right\rVert}_1 \f$ of type T
- * such that \f$ {\left\lVert \textbf{m} \right\rVert}_1 = \max\limits_j
+ *  @return a scalar \f$ {\left\lVert \textbf{m} \right\rVert}_1 \f$ of the
+ * real type of T such that \f$ {\left\lVert \textbf{m} \right\rVert}_1 = \max\limits_j
  * \sum\limits_{i=1}^M \left\lvert \textbf{m}_{ij} \right\rvert \f$
  *
  *  Computes the maximum absolute column sum norm of a matrix.
  */
 template <typename T, std::size_t M, std::size_t N>
-constexpr T macs(const matrix<T, M, N> &m) {
-  return max(
-      generate<N>([&m](std::size_t i) { return sum(abs(m.column(i))); }));
+constexpr detail::remove_complex_t<T> macs(const matrix<T, M, N> &m) {
+  using R = detail::remove_complex_t<T>;
+  return max(detail::reduce_axis<axis::column>(m, abs<T>,
+                                               detail::add_combine<R>));
 }
 
 /** @brief Computes the maximum absolute row sum norm
  *  @param m an \f$M \times N\f$ matrix
  *  @return a scalar \f$ {\left\lVert \textbf{m} \right\rVert}_\infty \f$ of
- * type T such that \f$ {\left\lVert \textbf{m} \right\rVert}_\infty = \max\limits_i
+ * the real type of T such that \f$ {\left\lVert \textbf{m} \right\rVert}_\infty = \max\limits_i
  * \sum\limits_{j=1}^N \left\lvert \textbf{m}_{ij} \right\rvert \f$
  *
  *  Computes the maximum absolute row sum norm of a matrix.
  */
 template <typename T, std::size_t M, std::size_t N>
-constexpr T mars(const matrix<T, M, N> &m) {
-  return max(generate<M>([&m](std::size_t i) { return sum(abs(m.row(i))); }));
+constexpr detail::remove_complex_t<T> mars(const matrix<T, M, N> &m) {
+  using R = detail::remove_complex_t<T>;
+  return max(
+      detail::reduce_axis<axis::row>(m, abs<T>, detail::add_combine<R>));
+}
+
+/** @brief Computes the Frobenius norm
+ *  @param m an \f$M \times N\f$ matrix of floating point type T
+ *  @return a scalar \f$ {\left\lVert \textbf{m} \right\rVert}_F =
+ *  \sqrt{\sum\limits_{i,j} \lvert \textbf{m}_{ij} \rvert^2} \f$ of the real
+ *  type of T
+ *
+ *  Computes the Frobenius norm of a matrix, scaling the elements when
+ *  necessary to avoid overflow and underflow.
+ */
+template <typename T, std::size_t M, std::size_t N>
+constexpr detail::remove_complex_t<T> normfro(const matrix<T, M, N> &m) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  return detail::scaled_norm2<T>(
+      M * N, [&m](std::size_t i) { return m[i / N][i % N]; });
 }
 
 /// @private
 template <typename T, std::size_t M, std::size_t N>
 constexpr std::tuple<matrix<T, M, N>, std::size_t, T>
-gauss_jordan_impl(matrix<T, M, N> m, T tolerance) {
+gauss_jordan_impl(matrix<T, M, N> m, detail::remove_complex_t<T> tolerance) {
   COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
-  COTILA_DETAIL_ASSERT_REAL(T)
 
-  // Define function for determining if an element is negligible
-  auto negligible = [&tolerance](const T &v) { return abs(v) < tolerance; };
+  // Magnitudes are compared squared, to avoid square roots of complex values
+  const auto tolerance2 = tolerance * tolerance;
+  auto negligible = [tolerance2](const T &v) {
+    // A zero tolerance still rejects exactly zero pivots
+    return detail::abs2(v) <= tolerance2;
+  };
 
   T det = 1;
   std::size_t rank = 0;
   std::size_t i = 0, j = 0;
   while (i < M && j < N) {
     // Choose largest magnitude as pivot to avoid adding different magnitudes
-    for (std::size_t ip = i + 1; ip < M; ++ip) {
-      if (abs(m[ip][j]) > abs(m[i][j])) {
-        for (std::size_t jp = 0; jp < N; ++jp) {
-          auto tmp = m[ip][jp];
-          m[ip][jp] = m[i][jp];
-          m[i][jp] = tmp;
-        }
-        det *= -1;
-        break;
+    std::size_t pivot = i;
+    for (std::size_t ip = i + 1; ip < M; ++ip)
+      if (detail::abs2(m[ip][j]) > detail::abs2(m[pivot][j]))
+        pivot = ip;
+    if (pivot != i) {
+      for (std::size_t jp = 0; jp < N; ++jp) {
+        auto tmp = m[pivot][jp];
+        m[pivot][jp] = m[i][jp];
+        m[i][jp] = tmp;
       }
+      det = detail::scale(det, -1);
     }
 
     // If m_ij is still 0, continue to the next column
@@ -170,8 +956,8 @@ gauss_jordan_impl(matrix<T, M, N> m, T tolerance) {
       // Scale m_ij to 1
       auto s = m[i][j];
       for (std::size_t jp = 0; jp < N; ++jp)
-        m[i][jp] /= s;
-      det /= s;
+        m[i][jp] = detail::div(m[i][jp], s);
+      det = detail::mul(det, s);
 
       // Eliminate other values in the column
       for (std::size_t ip = 0; ip < M; ++ip) {
@@ -181,7 +967,7 @@ gauss_jordan_impl(matrix<T, M, N> m, T tolerance) {
           auto s = m[ip][j];
           [&]() { // wrap this in a lambda to get around a gcc bug
             for (std::size_t jp = 0; jp < N; ++jp)
-              m[ip][jp] -= s * m[i][jp];
+              m[ip][jp] = detail::sub(m[ip][jp], detail::mul(s, m[i][jp]));
           }();
         }
       }
@@ -191,10 +977,14 @@ gauss_jordan_impl(matrix<T, M, N> m, T tolerance) {
 
       // Select next row
       ++i;
+    } else {
+      // The remainder of the column is negligible
+      for (std::size_t ip = i; ip < M; ++ip)
+        m[ip][j] = T(0);
     }
     ++j;
   }
-  det = (rank == M) ? det : 0;
+  det = (rank == M) ? det : T(0);
   return {m, rank, det};
 }
 
@@ -202,10 +992,105 @@ gauss_jordan_impl(matrix<T, M, N> m, T tolerance) {
 template <typename T, std::size_t M, std::size_t N>
 constexpr std::tuple<matrix<T, M, N>, std::size_t, T>
 gauss_jordan_impl(const matrix<T, M, N> &m) {
-  T tol = std::max(N, M) * std::numeric_limits<T>::epsilon() * mars(m);
+  using R = detail::remove_complex_t<T>;
+  R tol = std::max(N, M) * std::numeric_limits<R>::epsilon() * mars(m);
   return gauss_jordan_impl(m, tol);
 }
 
+/// @private
+namespace detail {
+
+#ifdef __SIZEOF_INT128__
+// Intermediate type of Bareiss elimination, wider than any standard integer
+__extension__ typedef __int128 bareiss_int;
+#else
+typedef std::intmax_t bareiss_int;
+#endif
+
+// a * b - c * d for Bareiss elimination, throwing on overflow
+constexpr bareiss_int bareiss_step(bareiss_int a, bareiss_int b,
+                                   bareiss_int c, bareiss_int d) {
+#ifdef __SIZEOF_INT128__
+  bareiss_int ab = 0, cd = 0, r = 0;
+  if (__builtin_mul_overflow(a, b, &ab) || __builtin_mul_overflow(c, d, &cd) ||
+      __builtin_sub_overflow(ab, cd, &r))
+    COTILA_DETAIL_THROW("integer overflow in Bareiss elimination");
+  return r;
+#else
+  constexpr bareiss_int max = std::numeric_limits<bareiss_int>::max();
+  constexpr bareiss_int min = std::numeric_limits<bareiss_int>::min();
+  auto overflows = [](bareiss_int x, bareiss_int y) {
+    if (x == 0 || y == 0)
+      return false;
+    if (x > 0)
+      return y > 0 ? x > max / y : y < min / x;
+    return y > 0 ? x < min / y : x < max / y;
+  };
+  if (overflows(a, b) || overflows(c, d))
+    COTILA_DETAIL_THROW("integer overflow in Bareiss elimination");
+  bareiss_int ab = a * b, cd = c * d;
+  if (cd > 0 ? ab < min + cd : ab > max + cd)
+    COTILA_DETAIL_THROW("integer overflow in Bareiss elimination");
+  return ab - cd;
+#endif
+}
+
+// Bareiss fraction-free elimination to row echelon form.  Every intermediate
+// value is a minor of m, so the divisions are exact and the magnitudes are
+// bounded by Hadamard's inequality.  Each step multiplies two minors, which
+// is computed in a 128-bit integer where available (otherwise
+// std::intmax_t) and throws if it overflows, as does a determinant that does
+// not fit T.  Returns the rank and the determinant (zero if the matrix is not
+// full rank).
+template <typename T, std::size_t M, std::size_t N>
+constexpr std::tuple<std::size_t, T> bareiss_impl(const matrix<T, M, N> &m) {
+  static_assert(std::is_integral_v<T>, "Bareiss elimination requires integers");
+  using W = bareiss_int;
+
+  W a[M][N] = {};
+  for (std::size_t i = 0; i < M; ++i)
+    for (std::size_t j = 0; j < N; ++j)
+      a[i][j] = static_cast<W>(m[i][j]);
+
+  W previous = 1;
+  bool negative = false;
+  std::size_t i = 0;
+  for (std::size_t j = 0; i < M && j < N; ++j) {
+    // Any nonzero pivot is exact, so take the first
+    std::size_t p = i;
+    while (p < M && a[p][j] == 0)
+      ++p;
+    if (p == M)
+      continue;
+    if (p != i) {
+      for (std::size_t jp = j; jp < N; ++jp) {
+        auto tmp = a[p][jp];
+        a[p][jp] = a[i][jp];
+        a[i][jp] = tmp;
+      }
+      negative = !negative;
+    }
+
+    for (std::size_t ip = i + 1; ip < M; ++ip) {
+      for (std::size_t jp = j + 1; jp < N; ++jp)
+        a[ip][jp] =
+            bareiss_step(a[i][j], a[ip][jp], a[ip][j], a[i][jp]) / previous;
+      a[ip][j] = 0;
+    }
+    previous = a[i][j];
+    ++i;
+  }
+
+  W det = (M == N && i == M) ? previous : W(0);
+  det = negative ? -det : det;
+  if (det < W(std::numeric_limits<T>::min()) ||
+      det > W(std::numeric_limits<T>::max()))
+    COTILA_DETAIL_THROW("determinant overflows the integer type");
+  return {i, static_cast<T>(det)};
+}
+
+} // namespace detail
+
 /** @brief Compute the reduced row echelon form
  *  @param m an \f$ M \times N \f$ matrix of type T
  *  @return an \f$ M \times N \f$ matrix of type T, the reduced row echelon form
@@ -232,30 +1117,103 @@ constexpr matrix<T, M, N> rref(const matrix<T, M, N> &m) {
  * elimination.
  */
 template <typename T, std::size_t M, std::size_t N>
-constexpr matrix<T, M, N> rref(const matrix<T, M, N> &m, T tolerance) {
-  return std::get<0>(gauss_jordan_impl(m), tolerance);
+constexpr matrix<T, M, N> rref(const matrix<T, M, N> &m,
+                               detail::remove_complex_t<T> tolerance) {
+  return std::get<0>(gauss_jordan_impl(m, tolerance));
 }
 
 /** @brief Compute the rank
  *  @param m \f$ M \times N \f$ matrix of type T
  *  @return a scalar \f$ \textrm{rank}\left(\textbf{m}\right) \f$
  *
- *  Computes the rank using the reduced row echelon form.
+ *  Computes the rank using the reduced row echelon form.  The rank of an
+ *  integer matrix is computed exactly with Bareiss fraction-free elimination,
+ *  as for `det`, and throws if an intermediate product overflows.
  */
 template <typename T, std::size_t M, std::size_t N>
 constexpr std::size_t rank(const matrix<T, M, N> &m) {
-  return std::get<1>(gauss_jordan_impl(m));
+  if constexpr (std::is_integral_v<T>)
+    return std::get<0>(detail::bareiss_impl(m));
+  else
+    return std::get<1>(gauss_jordan_impl(m));
 }
 
 /** @brief Compute the determinant
  *  @param m \f$ M \times M \f$ matrix of type T
  *  @return a scalar \f$ \left\lvert \textbf{m} \right\rvert \f$ of type T
  *
- *  Computes the determinant using the reduced row echelon form.
+ *  Computes the determinant using the reduced row echelon form.  The
+ *  determinant of an integer matrix is computed exactly with Bareiss
+ *  fraction-free elimination.  Each step multiplies two minors of
+ *  \f$ \textbf{m} \f$, which is computed in a 128-bit integer where the
+ *  compiler provides one (otherwise `std::intmax_t`).  Throws (or aborts, if
+ *  exceptions are disabled) if such a product overflows, or if the
+ *  determinant does not fit T.
  */
 template <typename T, std::size_t M>
 constexpr T det(const matrix<T, M, M> &m) {
-  return std::get<2>(gauss_jordan_impl(m));
+  if constexpr (std::is_integral_v<T>)
+    return std::get<1>(detail::bareiss_impl(m));
+  else
+    return std::get<2>(gauss_jordan_impl(m));
+}
+
+/** @brief computes the matrix inverse, if it exists
+ *  @param m an \f$ M \times M \f$ matrix of type T
+ *  @return The inverse of \f$ \textbf{m} \f$, \f$ \textbf{m}^{-1}\f$ such that
+ *  \f$ \textbf{m}\textbf{m}^{-1} = \textbf{m}^{-1}\textbf{m} = \textbf{I}_{M}
+ * \f$, or `std::nullopt` if \f$ \textbf{m} \f$ is singular
+ *
+ *  Computes the inverse of a matrix with a single pass of Gauss-Jordan
+ *  elimination on \f$ \left[ \textbf{m} \vert \textbf{I} \right] \f$.  The
+ *  matrix is singular if a column has no pivot with magnitude greater than
+ *  \f$ M \cdot \epsilon \cdot {\left\lVert \textbf{m} \right\rVert}_\infty \f$,
+ *  the tolerance used by `rank`.  Singularity is reported without
+ *  throwing, so this can be used without exceptions.
+ */
+template <typename T, std::size_t M>
+constexpr std::optional<matrix<T, M, M>> try_inverse(const matrix<T, M, M> &m) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  using R = detail::remove_complex_t<T>;
+  const R tolerance = M * std::numeric_limits<R>::epsilon() * mars(m);
+  const R tolerance2 = tolerance * tolerance;
+  auto negligible = [tolerance2](const T &v) {
+    // A zero tolerance still rejects exactly zero pivots
+    return detail::abs2(v) <= tolerance2;
+  };
+
+  auto a = horzcat(m, identity<T, M>);
+  for (std::size_t j = 0; j < M; ++j) {
+    // Choose largest magnitude as pivot to avoid adding different magnitudes
+    std::size_t pivot = j;
+    for (std::size_t ip = j + 1; ip < M; ++ip)
+      if (detail::abs2(a[ip][j]) > detail::abs2(a[pivot][j]))
+        pivot = ip;
+    if (pivot != j) {
+      for (std::size_t jp = j; jp < 2 * M; ++jp) {
+        auto tmp = a[pivot][jp];
+        a[pivot][jp] = a[j][jp];
+        a[j][jp] = tmp;
+      }
+    }
+    if (negligible(a[j][j]))
+      return std::nullopt;
+
+    // Scale the pivot to 1 and eliminate the other values in the column.
+    // Columns before the pivot no longer affect the result.
+    auto s = a[j][j];
+    for (std::size_t jp = j + 1; jp < 2 * M; ++jp)
+      a[j][jp] = detail::div(a[j][jp], s);
+    // The pivot row is scaled, so only exact zeros can be skipped.
+    for (std::size_t ip = 0; ip < M; ++ip) {
+      if (ip == j || a[ip][j] == T(0))
+        continue;
+      auto s = a[ip][j];
+      for (std::size_t jp = j + 1; jp < 2 * M; ++jp)
+        a[ip][jp] = detail::sub(a[ip][jp], detail::mul(s, a[j][jp]));
+    }
+  }
+  return generate<M, M>([&a](std::size_t i, std::size_t j) { return a[i][M + j]; });
 }
 
 /** @brief computes the matrix inverse
@@ -264,13 +1222,15 @@ constexpr T det(const matrix<T, M, M> &m) {
  *  \f$ \textbf{m}\textbf{m}^{-1} = \textbf{m}^{-1}\textbf{m} = \textbf{I}_{M}
  * \f$
  *
- *  Computes the inverse of a matrix using the reduced row echelon form.
+ *  Computes the inverse of a matrix, as with `try_inverse`.  Throws if the
+ *  matrix is singular (or aborts, if exceptions are disabled).
  */
 template <typename T, std::size_t M>
 constexpr matrix<T, M, M> inverse(const matrix<T, M, M> &m) {
-  if (rank(m) < M)
-    throw "matrix is not invertible";
-  return submat<M, M>(rref(horzcat(m, identity<T, M>)), 0, M);
+  auto inverted = try_inverse(m);
+  if (!inverted)
+    COTILA_DETAIL_THROW("matrix is not invertible");
+  return *inverted;
 }
 
 /** @brief computes the trace
@@ -285,6 +1245,179 @@ constexpr T trace(const matrix<T, M, M> &m) {
   return sum(generate<M>([&m](std::size_t i){ return m[i][i]; }));
 }
 
+/// @private
+namespace detail {
+
+// Computes the linear combination c0 m0 + c1 m1 + ... of matrices with real
+// coefficients, which remains constexpr for complex types
+template <typename R, typename T, std::size_t M, std::size_t N,
+          typename... Rest>
+constexpr matrix<T, M, N> combine(R c, const matrix<T, M, N> &m,
+                                  const Rest &... rest) {
+  matrix<T, M, N> combined = {};
+  for (std::size_t i = 0; i < M; ++i)
+    for (std::size_t j = 0; j < N; ++j)
+      combined[i][j] = scale(m[i][j], remove_complex_t<T>(c));
+  if constexpr (sizeof...(Rest) > 0) {
+    auto others = combine(rest...);
+    for (std::size_t i = 0; i < M; ++i)
+      for (std::size_t j = 0; j < N; ++j)
+        combined[i][j] = add(combined[i][j], others[i][j]);
+  }
+  return combined;
+}
+
+} // namespace detail
+
+/** @brief computes an integer power of a matrix
+ *  @param m an \f$ M \times M \f$ matrix of type T
+ *  @param n the exponent
+ *  @return \f$ \textbf{m}^n \f$, or \f$ \left(\textbf{m}^{-1}\right)^{-n} \f$
+ *  if n is negative
+ *
+ *  Computes an integer power of a matrix by repeated squaring, with
+ *  \f$ O(\log n) \f$ matrix multiplications.  Negative exponents require a
+ *  floating point type, and throw if the matrix is singular.
+ */
+template <typename T, std::size_t M>
+constexpr matrix<T, M, M> matpow(matrix<T, M, M> m, int n) {
+  // The magnitude is negated unsigned, which is defined for INT_MIN
+  unsigned e = n < 0 ? 0u - unsigned(n) : unsigned(n);
+  if (n < 0) {
+    if constexpr (std::is_integral_v<T>)
+      COTILA_DETAIL_THROW("negative power of an integral matrix");
+    else
+      m = inverse(m);
+  }
+  auto y = identity<T, M>;
+  while (e > 0) {
+    if (e % 2 == 1)
+      y = matmul(y, m);
+    e /= 2;
+    if (e > 0)
+      m = matmul(m, m);
+  }
+  return y;
+}
+
+/** @brief computes the matrix exponential
+ *  @param m an \f$ M \times M \f$ matrix of type T
+ *  @return \f$ e^{\textbf{m}} = \sum\limits_{k=0}^{\infty} \frac{\textbf{m}^k}{k!} \f$
+ *
+ *  Computes the matrix exponential by scaling and squaring with a [13/13]
+ *  Padé approximant (Higham, "The scaling and squaring method for the matrix
+ *  exponential revisited", 2005).  The matrix is scaled by a power of two
+ *  until its 1-norm is small enough for the approximant to be accurate to
+ *  double precision, and the result is squared back.
+ */
+template <typename T, std::size_t M>
+constexpr matrix<T, M, M> expm(const matrix<T, M, M> &m) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  using R = detail::remove_complex_t<T>;
+  constexpr R theta = 5.371920351148152;
+  constexpr R b[] = {64764752532480000., 32382376266240000., 7771770303897600.,
+                     1187353796428800.,  129060195264000.,   10559470521600.,
+                     670442572800.,      33522128640.,       1323241920.,
+                     40840800.,          960960.,            16380.,
+                     182.,               1.};
+
+  int s = 0;
+  R factor = 1;
+  for (R norm = macs(m); norm * factor > theta; factor /= 2)
+    ++s;
+
+  const auto a = detail::combine(factor, m);
+  const auto a2 = matmul(a, a);
+  const auto a4 = matmul(a2, a2);
+  const auto a6 = matmul(a4, a2);
+  constexpr auto I = identity<T, M>;
+  const auto u = matmul(
+      a, detail::combine(R(1), matmul(a6, detail::combine(b[13], a6, b[11], a4,
+                                                          b[9], a2)),
+                         b[7], a6, b[5], a4, b[3], a2, b[1], I));
+  const auto v =
+      detail::combine(R(1), matmul(a6, detail::combine(b[12], a6, b[10], a4,
+                                                       b[8], a2)),
+                      b[6], a6, b[4], a4, b[2], a2, b[0], I);
+  auto e = matmul(inverse(detail::combine(R(1), v, R(-1), u)),
+                  detail::combine(R(1), v, R(1), u));
+  for (int k = 0; k < s; ++k)
+    e = matmul(e, e);
+  return e;
+}
+
+/** @brief computes the principal matrix square root
+ *  @param m an \f$ M \times M \f$ matrix of type T
+ *  @return \f$ \textbf{m}^{1/2} \f$, the square root of \f$ \textbf{m} \f$
+ *  whose eigenvalues have positive real parts
+ *
+ *  Computes the principal square root with the Denman-Beavers iteration,
+ *  which converges quadratically.  The matrix must not have eigenvalues on
+ *  the closed negative real axis.  Throws if the matrix becomes singular or
+ *  the iteration does not converge.
+ */
+template <typename T, std::size_t M>
+constexpr matrix<T, M, M> sqrtm(const matrix<T, M, M> &m) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  using R = detail::remove_complex_t<T>;
+  auto y = m;
+  auto z = identity<T, M>;
+  // Iterate until the relative change is of the order of the square root of
+  // the rounding error, after which one more iteration converges
+  const R tolerance = R(cotila::sqrt(std::numeric_limits<R>::epsilon()));
+  for (int k = 0; k < 64; ++k) {
+    auto y_next = detail::combine(R(0.5), y, R(0.5), inverse(z));
+    z = detail::combine(R(0.5), z, R(0.5), inverse(y));
+    R change = normfro(detail::combine(R(1), y_next, R(-1), y));
+    y = y_next;
+    if (change <= tolerance * normfro(y))
+      return detail::combine(R(0.5), y, R(0.5), inverse(z));
+  }
+  COTILA_DETAIL_THROW("matrix square root did not converge");
+}
+
+/** @brief computes the principal matrix logarithm
+ *  @param m an \f$ M \times M \f$ matrix of type T
+ *  @return \f$ \log \textbf{m} \f$, the logarithm of \f$ \textbf{m} \f$ whose
+ *  eigenvalues have imaginary parts in \f$ \left(-\pi, \pi\right) \f$
+ *
+ *  Computes the principal logarithm by inverse scaling and squaring: square
+ *  roots are taken until the matrix is close to the identity, the logarithm
+ *  is evaluated with the series
+ *  \f$ \log \textbf{a} = 2 \sum\limits_{k=0}^{\infty} \frac{\textbf{z}^{2k+1}}{2k+1} \f$
+ *  with \f$ \textbf{z} = \left(\textbf{a} - \textbf{I}\right)\left(\textbf{a} + \textbf{I}\right)^{-1} \f$,
+ *  and the result is scaled back.  The matrix must not have eigenvalues on
+ *  the closed negative real axis.
+ */
+template <typename T, std::size_t M>
+constexpr matrix<T, M, M> logm(const matrix<T, M, M> &m) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  using R = detail::remove_complex_t<T>;
+  constexpr auto I = identity<T, M>;
+  auto a = m;
+  R factor = 2;
+  for (int k = 0; macs(detail::combine(R(1), a, R(-1), I)) > R(0.25); ++k) {
+    if (k == 64)
+      COTILA_DETAIL_THROW("matrix logarithm did not converge");
+    a = sqrtm(a);
+    factor *= 2;
+  }
+
+  const auto z = matmul(detail::combine(R(1), a, R(-1), I),
+                        inverse(detail::combine(R(1), a, R(1), I)));
+  const auto z2 = matmul(z, z);
+  auto power = z;
+  auto series = z;
+  for (int k = 1; k < 64; ++k) {
+    power = matmul(power, z2);
+    auto term = detail::combine(R(1) / R(2 * k + 1), power);
+    series = detail::combine(R(1), series, R(1), term);
+    if (normfro(term) <= std::numeric_limits<R>::epsilon() * normfro(series))
+      break;
+  }
+  return detail::combine(factor, series);
+}
+
 /** }@*/
 
 } // namespace cotila
@@ -9,6 +9,7 @@
 #include <cotila/vector/utility.h>
 #include <cotila/vector/vector.h>
 #include <cotila/detail/assert.h>
+#include <cotila/detail/config.h>
 #include <tuple>
 
 namespace cotila {
@@ -38,11 +39,11 @@ template <typename T, std::size_t N, std::size_t M> struct matrix {
    *  @param i index of the row to extract
    *  @return the selected row
    *
-   *  Extracts a row from the matrix.
+   *  Extracts a row from the matrix.  The index is checked according to
+   *  `COTILA_BOUNDS_CHECK`.
    */
   constexpr vector<T, M> row(std::size_t i) const {
-    if (i >= N)
-      throw "index out of range";
+    COTILA_DETAIL_CHECK_BOUNDS(i < N);
     return generate<M>([i, this](std::size_t j) { return arrays[i][j]; });
   }
 
@@ -50,11 +51,11 @@ template <typename T, std::size_t N, std::size_t M> struct matrix {
    *  @param i index of the column to extract
    *  @return the selected row
    *
-   *  Extracts a column from the matrix
+   *  Extracts a column from the matrix.  The index is checked according to
+   *  `COTILA_BOUNDS_CHECK`.
    */
   constexpr vector<T, N> column(std::size_t i) const {
-    if (i >= M)
-      throw "index out of range";
+    COTILA_DETAIL_CHECK_BOUNDS(i < M);
     return generate<N>([i, this](std::size_t j) { return arrays[j][i]; });
   }
 
@@ -73,6 +74,45 @@ template <typename T, std::size_t N, std::size_t M> struct matrix {
   constexpr T const *operator[](std::size_t i) const { return arrays[i]; }
   ///@}
 
+  /** @name Modifiers */
+  ///@{
+  /** @brief swaps two rows in place
+   *  @param a the index of a row to swap
+   *  @param b the index of a row to swap
+   *  @return a reference to this matrix
+   *
+   *  Exchanges two rows without copying the matrix.  The indices are checked
+   *  according to `COTILA_BOUNDS_CHECK`.
+   */
+  constexpr matrix &swaprow(std::size_t a, std::size_t b) {
+    COTILA_DETAIL_CHECK_BOUNDS(a < N && b < N);
+    for (std::size_t j = 0; j < M; ++j) {
+      T tmp = arrays[a][j];
+      arrays[a][j] = arrays[b][j];
+      arrays[b][j] = tmp;
+    }
+    return *this;
+  }
+
+  /** @brief swaps two columns in place
+   *  @param a the index of a column to swap
+   *  @param b the index of a column to swap
+   *  @return a reference to this matrix
+   *
+   *  Exchanges two columns without copying the matrix.  The indices are
+   *  checked according to `COTILA_BOUNDS_CHECK`.
+   */
+  constexpr matrix &swapcol(std::size_t a, std::size_t b) {
+    COTILA_DETAIL_CHECK_BOUNDS(a < M && b < M);
+    for (std::size_t i = 0; i < N; ++i) {
+      T tmp = arrays[i][a];
+      arrays[i][a] = arrays[i][b];
+      arrays[i][b] = tmp;
+    }
+    return *this;
+  }
+  ///@}
+
   T arrays[N][M]; ///< @private
 };
 
@@ -107,6 +147,17 @@ matrix(const T (&)[M][N][2])->matrix<std::complex<T>, M, N>;
 
 ///@}
 
+/** @brief Selects the rows or columns of a matrix
+ *
+ *  Used by broadcasting and reductions to select whether a vector has one
+ *  element per row (`axis::row`) or one element per column (`axis::column`) of
+ *  a matrix.
+ */
+enum class axis {
+  row,   ///< one element per row
+  column ///< one element per column
+};
+
 /** @}*/
 
 } // namespace cotila
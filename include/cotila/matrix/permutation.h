@@ -0,0 +1,238 @@
+/** @file
+ *  @brief Contains the definition of the `cotila::permutation` class.
+ */
+
+#ifndef COTILA_MATRIX_PERMUTATION_H_
+#define COTILA_MATRIX_PERMUTATION_H_
+
+#include <cotila/detail/config.h>
+#include <cotila/matrix/matrix.h>
+#include <cotila/vector/vector.h>
+#include <cstddef>
+
+namespace cotila {
+
+/** @brief A permutation of N indices
+ *  @tparam N number of indices
+ *
+ *  `cotila::permutation` represents a reordering of N elements by the index
+ *  each element is taken from, so that permuting a vector \f$ \textbf{v} \f$
+ *  by \f$ p \f$ produces \f$ \textbf{v}_{p(i)} \f$ at position i.
+ *
+ *  Swaps modify the permutation in place, so a sequence of row exchanges
+ *  (such as the pivots of an elimination) can be recorded and then applied
+ *  to a vector or matrix with a single gather:
+ *  \code{.cpp}
+ *  cotila::permutation<4> p;
+ *  p.swap(0, 2).swap(1, 3);
+ *  auto y = cotila::permute<cotila::axis::row>(x, p);
+ *  \endcode
+ */
+template <std::size_t N> class permutation {
+public:
+  static_assert(N != 0, "permutation must contain at least one index");
+
+  using size_type = std::size_t;
+  static constexpr size_type size = N; ///< @brief number of indices
+
+  /** @brief constructs the identity permutation
+   */
+  constexpr permutation() {
+    for (size_type i = 0; i < N; ++i)
+      p[i] = i;
+  }
+
+  /** @brief constructs a permutation from indices
+   *  @param indices an N-vector containing each of the indices
+   *  \f$ 0, \ldots, N - 1 \f$ exactly once, where `indices[i]` is \f$ p(i) \f$
+   *
+   *  Throws if `indices` is not a permutation.
+   */
+  constexpr explicit permutation(const vector<size_type, N> &indices) {
+    bool seen[N] = {};
+    for (size_type i = 0; i < N; ++i) {
+      if (indices[i] >= N || seen[indices[i]])
+        COTILA_DETAIL_THROW("indices are not a permutation");
+      seen[indices[i]] = true;
+      p[i] = indices[i];
+    }
+  }
+
+  /** @brief access specified index
+   *  @param i position of the index
+   *  @return \f$ p(i) \f$, the index of the element moved to position i
+   */
+  constexpr size_type operator[](size_type i) const noexcept { return p[i]; }
+
+  /** @brief returns the indices
+   *  @return an N-vector containing \f$ p(i) \f$ at position i
+   */
+  constexpr vector<size_type, N> indices() const {
+    vector<size_type, N> v = {};
+    for (size_type i = 0; i < N; ++i)
+      v[i] = p[i];
+    return v;
+  }
+
+  /** @brief exchanges two positions
+   *  @param i a position to exchange
+   *  @param j a position to exchange
+   *  @return a reference to this permutation
+   *
+   *  Composes the permutation with a transposition, in place, so that the
+   *  elements moved to positions i and j are exchanged.  The positions are
+   *  checked according to `COTILA_BOUNDS_CHECK`.
+   */
+  constexpr permutation &swap(size_type i, size_type j) {
+    COTILA_DETAIL_CHECK_BOUNDS(i < N && j < N);
+    auto tmp = p[i];
+    p[i] = p[j];
+    p[j] = tmp;
+    return *this;
+  }
+
+  /** @brief computes the sign
+   *  @return 1 if the permutation is even, or -1 if it is odd
+   *
+   *  The sign is the determinant of the corresponding permutation matrix.
+   */
+  constexpr int sign() const {
+    bool visited[N] = {};
+    bool odd = false;
+    for (size_type i = 0; i < N; ++i) {
+      // A cycle of length k is composed of k - 1 transpositions
+      size_type length = 0;
+      for (size_type j = i; !visited[j]; j = p[j]) {
+        visited[j] = true;
+        ++length;
+      }
+      if (length % 2 == 0 && length != 0)
+        odd = !odd;
+    }
+    return odd ? -1 : 1;
+  }
+
+private:
+  size_type p[N] = {};
+};
+
+/** \addtogroup matrix
+ *  @{
+ */
+
+/** @brief composes two permutations
+ *  @param a a permutation of N indices
+ *  @param b a permutation of N indices
+ *  @return the permutation \f$ c \f$ such that \f$ c(i) = b(a(i)) \f$
+ *
+ *  Composes two permutations, such that permuting by the result is equivalent
+ *  to permuting by `b` and then by `a`.
+ */
+template <std::size_t N>
+constexpr permutation<N> compose(const permutation<N> &a,
+                                 const permutation<N> &b) {
+  vector<std::size_t, N> c = {};
+  for (std::size_t i = 0; i < N; ++i)
+    c[i] = b[a[i]];
+  return permutation<N>(c);
+}
+
+/** @brief computes the inverse permutation
+ *  @param p a permutation of N indices
+ *  @return the permutation \f$ p^{-1} \f$ such that \f$ p^{-1}(p(i)) = i \f$
+ *
+ *  Computes the inverse of a permutation, which undoes it.
+ */
+template <std::size_t N>
+constexpr permutation<N> inverse(const permutation<N> &p) {
+  vector<std::size_t, N> inverted = {};
+  for (std::size_t i = 0; i < N; ++i)
+    inverted[p[i]] = i;
+  return permutation<N>(inverted);
+}
+
+/** @brief permutes a vector
+ *  @param v an N-vector of type T
+ *  @param p a permutation of N indices
+ *  @return an N-vector \f$ \textbf{v}' \f$ of type T such that
+ *  \f$ {\textbf{v}'}_i = \textbf{v}_{p(i)} \f$
+ *
+ *  Permutes the elements of a vector.
+ */
+template <typename T, std::size_t N>
+constexpr vector<T, N> permute(const vector<T, N> &v,
+                               const permutation<N> &p) {
+  vector<T, N> permuted = {};
+  for (std::size_t i = 0; i < N; ++i)
+    permuted[i] = v[p[i]];
+  return permuted;
+}
+
+/** @brief permutes the rows or columns of a matrix
+ *  @tparam A `axis::row` to permute the rows, or `axis::column` to permute
+ *  the columns
+ *  @param m an \f$ M \times N \f$ matrix of type T
+ *  @param p a permutation of M (for `axis::row`) or N (for `axis::column`)
+ *  indices
+ *  @return an \f$ M \times N \f$ matrix \f$ \textbf{m}' \f$ of type T such that
+ *  \f$ {\textbf{m}'}_{ij} = \textbf{m}_{p(i),\ j} \f$ or
+ *  \f$ {\textbf{m}'}_{ij} = \textbf{m}_{i,\ p(j)} \f$
+ *
+ *  Permutes the rows or columns of a matrix in a single pass.
+ */
+template <axis A, typename T, std::size_t M, std::size_t N, std::size_t K>
+constexpr matrix<T, M, N> permute(const matrix<T, M, N> &m,
+                                  const permutation<K> &p) {
+  static_assert(K == (A == axis::row ? M : N),
+                "permutation size must match the permuted axis");
+  matrix<T, M, N> permuted = {};
+  for (std::size_t i = 0; i < M; ++i)
+    for (std::size_t j = 0; j < N; ++j)
+      permuted[i][j] = A == axis::row ? m[p[i]][j] : m[i][p[j]];
+  return permuted;
+}
+
+/** @brief converts a permutation into a permutation matrix
+ *  @param p a permutation of N indices
+ *  @return an \f$ N \times N \f$ matrix \f$ \textbf{P} \f$ of type T such that
+ *  \f$ \textbf{P}_{ij} = \begin{cases} 1 & j = p(i)\\ 0 & \textrm{otherwise} \end{cases} \f$
+ *
+ *  Converts a permutation into the matrix that permutes rows when multiplied
+ *  on the left.
+ */
+template <typename T, std::size_t N>
+constexpr matrix<T, N, N> as_matrix(const permutation<N> &p) {
+  matrix<T, N, N> m = {};
+  for (std::size_t i = 0; i < N; ++i)
+    m[i][p[i]] = T(1);
+  return m;
+}
+
+/** @brief checks if two permutations are equal
+ *  @param a a permutation of N indices
+ *  @param b a permutation of N indices
+ *  @return true if \f$ a(i) = b(i) \f$ for all i
+ */
+template <std::size_t N>
+constexpr bool operator==(const permutation<N> &a, const permutation<N> &b) {
+  for (std::size_t i = 0; i < N; ++i)
+    if (a[i] != b[i])
+      return false;
+  return true;
+}
+
+/** @brief checks if two permutations are not equal
+ *  @param a a permutation of N indices
+ *  @param b a permutation of N indices
+ *  @return true if \f$ a(i) \neq b(i) \f$ for any i
+ */
+template <std::size_t N>
+constexpr bool operator!=(const permutation<N> &a, const permutation<N> &b) {
+  return !(a == b);
+}
+
+/** @}*/
+
+} // namespace cotila
+
+#endif // COTILA_MATRIX_PERMUTATION_H_
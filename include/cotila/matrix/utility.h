@@ -1,6 +1,7 @@
 #ifndef COTILA_MATRIX_UTILITY_H_
 #define COTILA_MATRIX_UTILITY_H_
 
+#include <cotila/detail/config.h>
 #include <cotila/matrix/matrix.h>
 #include <tuple>
 
@@ -109,17 +110,11 @@ constexpr matrix<T, M * Row, N * Col> repmat(const matrix<T, M, N> &m) {
  *  @return an \f$ M \times N \f$ matrix \f$ \textbf{m}' \f$ of type T such that
  *  \f$ {\textbf{m}'}_{ij} = \begin{cases} \textbf{m}_{bj} & i = a\\ \textbf{m}_{aj} & i = b\\ \textbf{m}_{ij} & \textrm{otherwise} \end{cases} \f$
  *
- *  Swap two rows of a matrix.
+ *  Swap two rows of a matrix.  `matrix::swaprow` swaps them in place.
  */
 template <std::size_t M, std::size_t N, typename T>
 constexpr matrix<T, M, N> swaprow(matrix<T, M, N> m, std::size_t a, std::size_t b){
-    for (int i = 0; i < N; i++)
-    {
-        T tmp = m[a][i];
-        m[a][i] = m[b][i];
-        m[b][i] = tmp;
-    }
-    return m;
+    return m.swaprow(a, b);
 }
 
 /** @brief swaps columns of a matrix
@@ -129,17 +124,11 @@ constexpr matrix<T, M, N> swaprow(matrix<T, M, N> m, std::size_t a, std::size_t
  *  @return an \f$ M \times N \f$ matrix \f$ \textbf{m}' \f$ of type T such that
  *  \f$ {\textbf{m}'}_{ij} = \begin{cases} \textbf{m}_{ib} & j = a\\ \textbf{m}_{ia} & j = b\\ \textbf{m}_{ij} & \textrm{otherwise} \end{cases} \f$
  *
- *  Swap two rows of a matrix.
+ *  Swap two columns of a matrix.  `matrix::swapcol` swaps them in place.
  */
 template <std::size_t M, std::size_t N, typename T>
 constexpr matrix<T, M, N> swapcol(matrix<T, M, N> m, std::size_t a, std::size_t b){
-    for (int i = 0; i < N; i++)
-    {
-        T tmp = m[i][a];
-        m[i][a] = m[i][b];
-        m[i][b] = tmp;
-    }
-    return m;
+    return m.swapcol(a, b);
 }
 
 /** @brief horizontally concatenates two matrices
@@ -179,11 +168,12 @@ constexpr matrix<T, M + N, P> vertcat(const matrix<T, M, P> &a, const matrix<T,
  *  @return an \f$ P \times Q \f$ submatrix \f$ \textbf{m}' \f$ of type T such that
  *  \f$ {\textbf{m}'}_{ij} = \textbf{m}_{\left(a + i\right),\ \left(b + j\right)} \f$
  *
- *  Extracts the submatrix of a matrix.
+ *  Extracts the submatrix of a matrix.  The indices are checked according to
+ *  `COTILA_BOUNDS_CHECK`.
  */
 template<std::size_t P, std::size_t Q, std::size_t M, std::size_t N, typename T>
 constexpr matrix<T, P, Q> submat(const matrix<T, M, N> &m, std::size_t a, std::size_t b){
-    if ((a + P > M) || (b + Q > N)) throw "index out of range";
+    COTILA_DETAIL_CHECK_BOUNDS(a + P <= M && b + Q <= N);
     return generate<P, Q>([&m, &a, &b](std::size_t i, std::size_t j){
         return m[a + i][b + j];
     });
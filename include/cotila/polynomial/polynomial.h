@@ -0,0 +1,317 @@
+/** @file
+ *  @brief Contains the definition of the `cotila::polynomial` class.
+ */
+
+#ifndef COTILA_POLYNOMIAL_POLYNOMIAL_H_
+#define COTILA_POLYNOMIAL_POLYNOMIAL_H_
+
+#include <complex>
+#include <cotila/detail/assert.h>
+#include <cotila/detail/complex.h>
+#include <cotila/detail/config.h>
+#include <cotila/detail/type_traits.h>
+#include <cotila/scalar/math.h>
+#include <cotila/vector/vector.h>
+#include <cstddef>
+#include <limits>
+
+namespace cotila {
+
+/** @brief A polynomial with coefficients in a vector
+ *  @tparam T scalar type of the coefficients
+ *  @tparam N number of coefficients
+ *
+ *  `cotila::polynomial` represents the polynomial of degree at most
+ *  \f$ N - 1 \f$
+ *  \f$ p(x) = \textbf{c}_0 + \textbf{c}_1 x + \ldots + \textbf{c}_{N-1} x^{N-1} \f$,
+ *  with coefficients in ascending powers of x.  It is evaluated with Horner's
+ *  method.  Evaluating a buffer of arguments vectorizes across the arguments:
+ *  \code{.cpp}
+ *  constexpr auto p = cotila::polyfit<4>(x_table, y_table);
+ *  p(in, out, n);
+ *  \endcode
+ */
+template <typename T, std::size_t N> class polynomial {
+  COTILA_DETAIL_ASSERT_ARITHMETIC(T)
+
+public:
+  using value_type = T;
+  static constexpr std::size_t size = N; ///< @brief number of coefficients
+
+  /** @brief constructs a polynomial
+   *  @param coefficients an N-vector of coefficients, in ascending powers
+   */
+  constexpr explicit polynomial(const vector<T, N> &coefficients)
+      : c(coefficients) {}
+
+  /** @brief returns the coefficients
+   *  @return an N-vector of coefficients, in ascending powers
+   */
+  constexpr const vector<T, N> &coefficients() const { return c; }
+
+  /** @brief evaluates the polynomial
+   *  @param x the argument
+   *  @return \f$ p(x) \f$
+   */
+  constexpr T operator()(T x) const { return evaluate(c, x); }
+
+  /** @brief evaluates the polynomial for a buffer of arguments
+   *  @param in pointer to `n` arguments
+   *  @param out pointer to `n` values
+   *  @param n number of values
+   *
+   *  Evaluates the polynomial at each of the arguments.  The coefficients are
+   *  copied before evaluation, so that they cannot alias the output and the
+   *  loop can be vectorized.  `in` and `out` may point to the same buffer.
+   */
+  constexpr void operator()(const T *in, T *out, std::size_t n) const {
+    const vector<T, N> coefficients = c;
+    for (std::size_t i = 0; i < n; ++i)
+      out[i] = evaluate(coefficients, in[i]);
+  }
+
+  /** @brief evaluates the polynomial for a vector of arguments
+   *  @param v an M-vector of arguments
+   *  @return an M-vector of values
+   */
+  template <std::size_t M>
+  constexpr vector<T, M> operator()(const vector<T, M> &v) const {
+    vector<T, M> evaluated = {};
+    (*this)(v.array, evaluated.array, M);
+    return evaluated;
+  }
+
+private:
+  static constexpr T evaluate(const vector<T, N> &coefficients, T x) {
+    T y = coefficients[N - 1];
+    for (std::size_t k = N - 1; k-- > 0;)
+      y = detail::add(detail::mul(y, x), coefficients[k]);
+    return y;
+  }
+
+  vector<T, N> c;
+};
+
+/// @private
+namespace detail {
+
+// Square root of a complex value, with the branch cut on the negative real
+// axis
+template <typename R>
+constexpr std::complex<R> complex_sqrt(const std::complex<R> &z) {
+  R magnitude = cotila::abs(z);
+  R re = cotila::sqrt((magnitude + z.real()) / R(2));
+  R im = cotila::sqrt((magnitude - z.real()) / R(2));
+  return {re, z.imag() < 0 ? -im : im};
+}
+
+// Magnitude used for convergence tests, which avoids a square root
+template <typename R> constexpr R abs1(const std::complex<R> &z) {
+  return (z.real() < 0 ? -z.real() : z.real()) +
+         (z.imag() < 0 ? -z.imag() : z.imag());
+}
+
+// Eigenvalues of an upper Hessenberg matrix, by the shifted QR algorithm with
+// Givens rotations and deflation
+template <typename R, std::size_t N>
+constexpr vector<std::complex<R>, N>
+hessenberg_eigenvalues(std::complex<R> (&h)[N][N]) {
+  using C = std::complex<R>;
+  constexpr R eps = std::numeric_limits<R>::epsilon();
+  constexpr std::size_t max_iterations = 30;
+
+  vector<C, N> eigenvalues = {};
+  std::size_t hi = N - 1, iterations = 0;
+  while (hi > 0) {
+    // Find the start of the unreduced block ending at hi
+    std::size_t lo = hi;
+    while (lo > 0 &&
+           abs1(h[lo][lo - 1]) > eps * (abs1(h[lo - 1][lo - 1]) + abs1(h[lo][lo])))
+      --lo;
+    if (lo == hi) {
+      eigenvalues[hi] = h[hi][hi];
+      --hi;
+      iterations = 0;
+      continue;
+    }
+    if (iterations++ == max_iterations)
+      COTILA_DETAIL_THROW("eigenvalues did not converge");
+
+    // Wilkinson shift, the eigenvalue of the trailing 2x2 block closest to
+    // the last diagonal element.  Occasionally use an exceptional shift to
+    // break cycles.
+    C shift;
+    if (iterations % 10 == 0) {
+      shift = add(h[hi][hi], C(abs1(h[hi][hi - 1]), 0));
+    } else {
+      C a = h[hi - 1][hi - 1], b = h[hi - 1][hi], c = h[hi][hi - 1],
+        d = h[hi][hi];
+      C half = scale(sub(a, d), R(0.5));
+      C root = complex_sqrt(add(mul(half, half), mul(b, c)));
+      C first = add(half, root), second = sub(half, root);
+      shift = add(d, abs2(first) < abs2(second) ? first : second);
+    }
+
+    // One QR step on the block: H - sI = QR, H' = RQ + sI
+    C rotation_c[N] = {}, rotation_s[N] = {};
+    for (std::size_t k = lo; k <= hi; ++k)
+      h[k][k] = sub(h[k][k], shift);
+    for (std::size_t k = lo; k < hi; ++k) {
+      C a = h[k][k], b = h[k + 1][k];
+      R r = cotila::sqrt(abs2(a) + abs2(b));
+      C cr = r == 0 ? C(1, 0) : scale(a, 1 / r);
+      C sr = r == 0 ? C() : scale(b, 1 / r);
+      rotation_c[k] = cr;
+      rotation_s[k] = sr;
+      for (std::size_t j = k; j <= hi; ++j) {
+        C x = h[k][j], y = h[k + 1][j];
+        h[k][j] = add(mul(cotila::conj(cr), x), mul(cotila::conj(sr), y));
+        h[k + 1][j] = sub(mul(cr, y), mul(sr, x));
+      }
+    }
+    for (std::size_t k = lo; k < hi; ++k) {
+      C cr = rotation_c[k], sr = rotation_s[k];
+      std::size_t last = k + 2 < hi ? k + 2 : hi;
+      for (std::size_t i = lo; i <= last; ++i) {
+        C x = h[i][k], y = h[i][k + 1];
+        h[i][k] = add(mul(x, cr), mul(y, sr));
+        h[i][k + 1] = sub(mul(y, cotila::conj(cr)), mul(x, cotila::conj(sr)));
+      }
+    }
+    for (std::size_t k = lo; k <= hi; ++k)
+      h[k][k] = add(h[k][k], shift);
+  }
+  eigenvalues[0] = h[0][0];
+  return eigenvalues;
+}
+
+} // namespace detail
+
+/** \addtogroup polynomial
+ *  @{
+ */
+
+/** @brief computes the derivative of a polynomial
+ *  @param p a polynomial with N coefficients of type T
+ *  @return the polynomial \f$ p' \f$ with \f$ N - 1 \f$ coefficients
+ */
+template <typename T, std::size_t N>
+constexpr polynomial<T, N - 1> derivative(const polynomial<T, N> &p) {
+  static_assert(N > 1, "polynomial must have at least two coefficients");
+  vector<T, N - 1> c = {};
+  for (std::size_t k = 1; k < N; ++k)
+    c[k - 1] = detail::scale(p.coefficients()[k], detail::remove_complex_t<T>(k));
+  return polynomial<T, N - 1>(c);
+}
+
+/** @brief fits a polynomial to samples by least squares
+ *  @tparam N number of coefficients of the polynomial
+ *  @param x an M-vector of arguments of type T
+ *  @param y an M-vector of values of type T
+ *  @return the polynomial p with N coefficients minimizing
+ *  \f$ \sum\limits_{i} \left(p(\textbf{x}_i) - \textbf{y}_i\right)^2 \f$
+ *
+ *  Fits a polynomial by solving the least squares problem with the
+ *  Householder QR decomposition of the Vandermonde matrix, which is better
+ *  conditioned than the normal equations.  Throws if the arguments do not
+ *  contain at least N distinct values.
+ */
+template <std::size_t N, typename T, std::size_t M>
+constexpr polynomial<T, N> polyfit(const vector<T, M> &x,
+                                   const vector<T, M> &y) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  COTILA_DETAIL_ASSERT_REAL(T)
+  static_assert(M >= N, "polyfit requires at least as many samples as coefficients");
+
+  // Vandermonde matrix and right hand side
+  T a[M][N] = {};
+  T b[M] = {};
+  for (std::size_t i = 0; i < M; ++i) {
+    T power = 1;
+    for (std::size_t j = 0; j < N; ++j) {
+      a[i][j] = power;
+      power *= x[i];
+    }
+    b[i] = y[i];
+  }
+
+  // Reduce to upper triangular, applying each reflection to the right hand
+  // side
+  const T tolerance = M * std::numeric_limits<T>::epsilon();
+  for (std::size_t k = 0; k < N; ++k) {
+    T scale = 0, norm2 = 0;
+    for (std::size_t i = 0; i < M; ++i)
+      scale += abs(a[i][k]);
+    for (std::size_t i = k; i < M; ++i)
+      norm2 += a[i][k] * a[i][k];
+    T norm = cotila::sqrt(norm2);
+    if (norm <= tolerance * scale)
+      COTILA_DETAIL_THROW("polyfit requires N distinct arguments");
+    T alpha = a[k][k] > 0 ? -norm : norm;
+    T v[M] = {};
+    for (std::size_t i = k; i < M; ++i)
+      v[i] = a[i][k];
+    v[k] -= alpha;
+    T v2 = norm2 - a[k][k] * a[k][k] + v[k] * v[k];
+
+    auto reflect = [&](auto &&element) {
+      T d = 0;
+      for (std::size_t i = k; i < M; ++i)
+        d += v[i] * element(i);
+      d = 2 * d / v2;
+      for (std::size_t i = k; i < M; ++i)
+        element(i) -= d * v[i];
+    };
+    for (std::size_t j = k + 1; j < N; ++j)
+      reflect([&a, j](std::size_t i) -> T & { return a[i][j]; });
+    reflect([&b](std::size_t i) -> T & { return b[i]; });
+    a[k][k] = alpha;
+  }
+
+  // Back substitution
+  vector<T, N> c = {};
+  for (std::size_t k = N; k-- > 0;) {
+    T sum = b[k];
+    for (std::size_t j = k + 1; j < N; ++j)
+      sum -= a[k][j] * c[j];
+    c[k] = sum / a[k][k];
+  }
+  return polynomial<T, N>(c);
+}
+
+/** @brief computes the roots of a polynomial
+ *  @param p a polynomial with N coefficients of type T
+ *  @return an \f$ \left(N - 1\right) \f$-vector of the complex roots of p, in
+ *  no particular order
+ *
+ *  Computes the roots as the eigenvalues of the companion matrix, found by
+ *  the shifted QR algorithm.  Throws if the leading coefficient is zero or
+ *  the iteration does not converge.
+ */
+template <typename T, std::size_t N>
+constexpr vector<std::complex<detail::remove_complex_t<T>>, N - 1>
+roots(const polynomial<T, N> &p) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  static_assert(N > 1, "polynomial must have at least two coefficients");
+  using R = detail::remove_complex_t<T>;
+  using C = std::complex<R>;
+  constexpr std::size_t D = N - 1;
+
+  const auto &c = p.coefficients();
+  if (c[D] == T(0))
+    COTILA_DETAIL_THROW("leading coefficient must be nonzero");
+
+  // Companion matrix of the monic polynomial, in upper Hessenberg form
+  C h[D][D] = {};
+  for (std::size_t j = 0; j < D; ++j)
+    h[0][j] = detail::sub(C(), detail::div(C(c[D - 1 - j]), C(c[D])));
+  for (std::size_t i = 1; i < D; ++i)
+    h[i][i - 1] = C(1, 0);
+  return detail::hessenberg_eigenvalues(h);
+}
+
+/** @}*/
+
+} // namespace cotila
+
+#endif // COTILA_POLYNOMIAL_POLYNOMIAL_H_
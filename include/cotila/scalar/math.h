@@ -5,8 +5,11 @@
 #ifndef COTILA_SCALAR_MATH_H_
 #define COTILA_SCALAR_MATH_H_
 
-#include <cotila/detail/type_traits.h>
+#include <cmath>
 #include <cotila/detail/assert.h>
+#include <cotila/detail/config.h>
+#include <cotila/detail/type_traits.h>
+#include <limits>
 #include <type_traits>
 
 namespace cotila {
@@ -15,22 +18,38 @@ namespace cotila {
  *  @{
  */
 
+/// @private
+namespace detail {
+
+// Newton's method for the square root of a nonnegative finite x.  Starting
+// above the root, the estimates decrease until they converge.
+template <typename T> constexpr T sqrt_impl(T x) {
+  if (x == 0 || x > std::numeric_limits<T>::max())
+    return x;
+  T prev = (1 + x) / 2;
+  T est = (prev + x / prev) / 2;
+  while (est < prev) {
+    prev = est;
+    est = (est + x / est) / 2;
+  }
+  return prev;
+}
+
+} // namespace detail
+
 /** @brief computes the square root
  *  @param x argument
  *  @return \f$ \sqrt{x} \f$
  *
- *  Computes the square root.
+ *  Computes the square root.  Outside of constant expressions, `std::sqrt` is
+ *  used if the compiler supports detecting constant evaluation.
  */
 constexpr double sqrt(double x) {
   if (x < 0)
-    throw "sqrt argument must be positive";
-  double prev = 0;
-  double est = (1 + x) / 2;
-  while (prev != est) {
-    prev = est;
-    est = (est + x / est) / 2;
-  }
-  return est;
+    COTILA_DETAIL_THROW("sqrt argument must be positive");
+  if (!COTILA_DETAIL_IS_CONSTANT_EVALUATED())
+    return std::sqrt(x);
+  return detail::sqrt_impl(x);
 }
 
 /** @brief computes the square root
@@ -41,6 +60,22 @@ constexpr double sqrt(double x) {
  */
 constexpr float sqrt(float x) { return float(sqrt(double(x))); }
 
+/** @brief computes the square root
+ *  @param x argument
+ *  @return \f$ \sqrt{x} \f$
+ *
+ *  Computes the square root in extended precision.  Outside of constant
+ *  expressions, `std::sqrt` is used if the compiler supports detecting
+ *  constant evaluation.
+ */
+constexpr long double sqrt(long double x) {
+  if (x < 0)
+    COTILA_DETAIL_THROW("sqrt argument must be positive");
+  if (!COTILA_DETAIL_IS_CONSTANT_EVALUATED())
+    return std::sqrt(x);
+  return detail::sqrt_impl(x);
+}
+
 /** @brief computes the absolute value
  *  @param x argument
  *  @return \f$ \lvert x \rvert \f$
@@ -91,7 +126,7 @@ constexpr double exponentiate(double x, int n) {
  */
 constexpr double nthroot(double x, int n) {
   if (x < 0)
-    throw "nth root argument must be positive";
+    COTILA_DETAIL_THROW("nth root argument must be positive");
   double prev = -1;
   double est = 1;
   while (prev != est) {
@@ -102,6 +137,110 @@ constexpr double nthroot(double x, int n) {
   return est;
 }
 
+/// @private
+template <typename T> constexpr T sincos_impl(T x, bool cosine) {
+  constexpr T max = std::numeric_limits<T>::max();
+  if (x != x || x > max || x < -max)
+    return std::numeric_limits<T>::quiet_NaN();
+  if (!COTILA_DETAIL_IS_CONSTANT_EVALUATED())
+    return cosine ? std::cos(x) : std::sin(x);
+
+  // Reduce x to r in [-pi/4, pi/4] with x = q*pi/2 + r, using a three-part
+  // representation of pi/2 whose leading parts have 33 significant bits, so
+  // that their products with q are exact for |q| < 2^20 (fdlibm's
+  // __ieee754_rem_pio2).  The parts are exact doubles, and their sum carries
+  // enough bits for long double.
+  constexpr T half_pi = T(1.57079632679489661923132169163975144L);
+  constexpr T half_pi_1 = T(1.57079632673412561417e+00);
+  constexpr T half_pi_2 = T(6.07710050630396597660e-11);
+  constexpr T half_pi_3 = T(2.02226624879595063154e-21);
+  if (x > 524288 * half_pi || x < -524288 * half_pi)
+    COTILA_DETAIL_THROW("sin and cos arguments must be less than 2^19 pi/2 in "
+                        "magnitude in constant expressions");
+  T qf = x / half_pi;
+  long long q = static_cast<long long>(qf < 0 ? qf - T(0.5) : qf + T(0.5));
+  T r = ((x - T(q) * half_pi_1) - T(q) * half_pi_2) - T(q) * half_pi_3;
+
+  // cos(x) = sin(x + pi/2)
+  unsigned quadrant = static_cast<unsigned>(q & 3) + (cosine ? 1 : 0);
+
+  // Evaluate the Taylor series of sin or cos until it converges
+  bool odd = quadrant % 2 == 0;
+  T term = odd ? r : T(1);
+  T sum = term;
+  for (int n = odd ? 2 : 1;; n += 2) {
+    term *= -r * r / T(n * (n + 1));
+    if (sum + term == sum)
+      break;
+    sum += term;
+  }
+  return (quadrant & 2) ? -sum : sum;
+}
+
+/** @brief computes the sine
+ *  @param x argument in radians
+ *  @return \f$ \sin x \f$
+ *
+ *  Computes the sine.  Outside of constant expressions, `std::sin` is used if
+ *  the compiler supports detecting constant evaluation.  Returns NaN for
+ *  infinite or NaN arguments.
+ *
+ *  The constexpr implementation only reduces arguments up to
+ *  \f$ 2^{19} \frac{\pi}{2} \approx 823550 \f$ in magnitude, and throws
+ *  for larger arguments, so they are a compile error in constant expressions.
+ *  Compilers that cannot detect constant evaluation use it at run time too.
+ */
+constexpr double sin(double x) { return sincos_impl(x, false); }
+
+/** @brief computes the sine
+ *  @param x argument in radians
+ *  @return \f$ \sin x \f$
+ *
+ *  Computes the sine.
+ */
+constexpr float sin(float x) { return float(sin(double(x))); }
+
+/** @brief computes the sine
+ *  @param x argument in radians
+ *  @return \f$ \sin x \f$
+ *
+ *  Computes the sine in extended precision, with the same argument range as
+ *  the double overload.
+ */
+constexpr long double sin(long double x) { return sincos_impl(x, false); }
+
+/** @brief computes the cosine
+ *  @param x argument in radians
+ *  @return \f$ \cos x \f$
+ *
+ *  Computes the cosine.  Outside of constant expressions, `std::cos` is used if
+ *  the compiler supports detecting constant evaluation.  Returns NaN for
+ *  infinite or NaN arguments.
+ *
+ *  The constexpr implementation only reduces arguments up to
+ *  \f$ 2^{19} \frac{\pi}{2} \approx 823550 \f$ in magnitude, and throws
+ *  for larger arguments, so they are a compile error in constant expressions.
+ *  Compilers that cannot detect constant evaluation use it at run time too.
+ */
+constexpr double cos(double x) { return sincos_impl(x, true); }
+
+/** @brief computes the cosine
+ *  @param x argument in radians
+ *  @return \f$ \cos x \f$
+ *
+ *  Computes the cosine.
+ */
+constexpr float cos(float x) { return float(cos(double(x))); }
+
+/** @brief computes the cosine
+ *  @param x argument in radians
+ *  @return \f$ \cos x \f$
+ *
+ *  Computes the cosine in extended precision, with the same argument range as
+ *  the double overload.
+ */
+constexpr long double cos(long double x) { return sincos_impl(x, true); }
+
 /** @brief computes the complex conjugate
  *  @param x argument
  *  @return \f$ \bar{x} \f$
@@ -0,0 +1,247 @@
+/** @file
+ *  @brief Discrete Fourier transforms of vectors.
+ */
+
+#ifndef COTILA_SIGNAL_FFT_H_
+#define COTILA_SIGNAL_FFT_H_
+
+#include <complex>
+#include <cotila/detail/assert.h>
+#include <cotila/detail/complex.h>
+#include <cotila/scalar/math.h>
+#include <cotila/vector/utility.h>
+#include <cotila/vector/vector.h>
+#include <cstddef>
+
+namespace cotila {
+
+/// @private
+namespace detail {
+
+// exp(-2 pi i k / n), reduced to the first octant so that roots of unity on
+// the axes are exact and symmetric roots are computed identically
+template <typename T>
+constexpr std::complex<T> unit_root(std::size_t k, std::size_t n) {
+  // Computed in at least double precision, and in long double for long double
+  using W = decltype(T() + double());
+  constexpr W half_pi = W(1.57079632679489661923132169163975144L);
+  k %= n;
+  std::size_t q = (4 * k) / n, r = (4 * k) % n;
+  W c = 1, s = 0;
+  if (2 * r <= n) {
+    c = cotila::cos(half_pi * W(r) / W(n));
+    s = cotila::sin(half_pi * W(r) / W(n));
+  } else {
+    c = cotila::sin(half_pi * W(n - r) / W(n));
+    s = cotila::cos(half_pi * W(n - r) / W(n));
+  }
+  W re[4] = {c, -s, -c, s};
+  W im[4] = {s, c, -s, -c};
+  return {T(re[q]), T(-im[q])};
+}
+
+constexpr std::size_t next_power_of_two(std::size_t n) {
+  std::size_t p = 1;
+  while (p < n)
+    p *= 2;
+  return p;
+}
+
+// Primes larger than this are transformed with Bluestein's algorithm
+constexpr std::size_t fft_max_direct_radix = 13;
+
+constexpr std::size_t fft_radix(std::size_t n) {
+  if (n % 4 == 0)
+    return 4;
+  for (std::size_t f = 2; f * f <= n; ++f)
+    if (n % f == 0)
+      return f;
+  return n;
+}
+
+template <typename T, std::size_t N>
+inline constexpr vector<std::complex<T>, N> fft_twiddles =
+    generate<N>([](std::size_t k) { return unit_root<T>(k, N); });
+
+template <typename T, std::size_t N> struct bluestein;
+
+// Decimation-in-time transform of in[0], in[stride], ... into out[0..N)
+template <typename T, std::size_t N>
+constexpr void fft_impl(const std::complex<T> *in, std::size_t stride,
+                        std::complex<T> *out) {
+  constexpr std::size_t R = fft_radix(N);
+  constexpr std::size_t M = N / R;
+  if constexpr (N == 1) {
+    out[0] = in[0];
+  } else if constexpr (R == N && N > fft_max_direct_radix) {
+    bluestein<T, N>::apply(in, stride, out);
+  } else {
+    // Transform each decimated subsequence
+    if constexpr (M > 1) {
+      for (std::size_t q = 0; q < R; ++q)
+        fft_impl<T, M>(in + q * stride, stride * R, out + q * M);
+    } else {
+      for (std::size_t q = 0; q < R; ++q)
+        out[q] = in[q * stride];
+    }
+
+    // Combine with twiddled R-point butterflies
+    constexpr auto &w = fft_twiddles<T, N>;
+    for (std::size_t k = 0; k < M; ++k) {
+      std::complex<T> a[R] = {};
+      a[0] = out[k];
+      for (std::size_t q = 1; q < R; ++q)
+        a[q] = mul(out[k + q * M], w[q * k]);
+      if constexpr (R == 2) {
+        out[k] = add(a[0], a[1]);
+        out[k + M] = sub(a[0], a[1]);
+      } else if constexpr (R == 4) {
+        auto y0 = add(a[0], a[2]), y1 = sub(a[0], a[2]);
+        auto y2 = add(a[1], a[3]), d = sub(a[1], a[3]);
+        std::complex<T> y3 = {d.imag(), -d.real()}; // -i * (a1 - a3)
+        out[k] = add(y0, y2);
+        out[k + M] = add(y1, y3);
+        out[k + 2 * M] = sub(y0, y2);
+        out[k + 3 * M] = sub(y1, y3);
+      } else {
+        for (std::size_t s = 0; s < R; ++s) {
+          std::complex<T> x = a[0];
+          for (std::size_t q = 1; q < R; ++q)
+            x = add(x, mul(a[q], w[((q * s) % R) * M]));
+          out[k + s * M] = x;
+        }
+      }
+    }
+  }
+}
+
+template <typename T, std::size_t N>
+constexpr vector<std::complex<T>, N>
+fft_vector(const vector<std::complex<T>, N> &v) {
+  vector<std::complex<T>, N> transformed = {};
+  fft_impl<T, N>(v.array, 1, transformed.array);
+  return transformed;
+}
+
+// Bluestein's algorithm expresses a prime-length transform as a circular
+// convolution of power-of-two length
+template <typename T, std::size_t N> struct bluestein {
+  static constexpr std::size_t M = next_power_of_two(2 * N - 1);
+
+  // exp(-pi i n^2 / N)
+  static constexpr vector<std::complex<T>, N> chirp =
+      generate<N>([](std::size_t n) {
+        return unit_root<T>((n * n) % (2 * N), 2 * N);
+      });
+
+  // Transform of the conjugate chirp, wrapped circularly
+  static constexpr vector<std::complex<T>, M> kernel =
+      fft_vector(generate<M>([](std::size_t n) {
+        std::size_t m = n < N ? n : M - n;
+        return m < N ? cotila::conj(chirp[m]) : std::complex<T>();
+      }));
+
+  static constexpr void apply(const std::complex<T> *in, std::size_t stride,
+                              std::complex<T> *out) {
+    vector<std::complex<T>, M> a = {};
+    for (std::size_t n = 0; n < N; ++n)
+      a[n] = mul(in[n * stride], chirp[n]);
+    a = fft_vector(a);
+
+    // Inverse transform of the product, via conjugation
+    for (std::size_t n = 0; n < M; ++n)
+      a[n] = cotila::conj(mul(a[n], kernel[n]));
+    a = fft_vector(a);
+    for (std::size_t k = 0; k < N; ++k)
+      out[k] = scale(mul(cotila::conj(a[k]), chirp[k]), T(1) / M);
+  }
+};
+
+} // namespace detail
+
+/** \addtogroup signal
+ *  @{
+ */
+
+/** @brief computes the discrete Fourier transform
+ *  @param v an N-vector of type `std::complex<T>`
+ *  @return an N-vector \f$ \textbf{X} \f$ of type `std::complex<T>` such that
+ *  \f$ \textbf{X}_k = \sum\limits_{n=0}^{N-1} \textbf{v}_n e^{-2 \pi i k n / N} \f$
+ *
+ *  Computes the discrete Fourier transform with a fast Fourier transform
+ *  planned at compile time for N.  Factors of 4 and 2 use radix-4 and radix-2
+ *  butterflies, other small factors use mixed-radix butterflies, and large
+ *  prime sizes use Bluestein's algorithm.  Twiddle factors are computed at
+ *  compile time.
+ */
+template <typename T, std::size_t N>
+constexpr vector<std::complex<T>, N> fft(const vector<std::complex<T>, N> &v) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  return detail::fft_vector(v);
+}
+
+/** @brief computes the inverse discrete Fourier transform
+ *  @param v an N-vector of type `std::complex<T>`
+ *  @return an N-vector \f$ \textbf{x} \f$ of type `std::complex<T>` such that
+ *  \f$ \textbf{x}_n = \frac{1}{N} \sum\limits_{k=0}^{N-1} \textbf{v}_k e^{2 \pi i k n / N} \f$
+ *
+ *  Computes the inverse discrete Fourier transform, such that
+ *  `ifft(fft(v))` is equal to `v` (within rounding error).
+ */
+template <typename T, std::size_t N>
+constexpr vector<std::complex<T>, N>
+ifft(const vector<std::complex<T>, N> &v) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  auto transformed =
+      detail::fft_vector(elementwise(cotila::conj<std::complex<T>>, v));
+  return elementwise(
+      [](std::complex<T> x) {
+        return std::complex<T>(x.real() / N, -x.imag() / N);
+      },
+      transformed);
+}
+
+/** @brief computes the discrete Fourier transform of a real vector
+ *  @param v an N-vector of real type T
+ *  @return an \f$ \left(\lfloor N/2 \rfloor + 1\right) \f$-vector of type
+ *  `std::complex<T>` containing the non-negative frequency terms of
+ *  `fft(v)`
+ *
+ *  Computes the discrete Fourier transform of a real vector.  The remaining
+ *  terms are the complex conjugates of these, by Hermitian symmetry.  For even
+ *  N, the transform is computed with a single complex transform of size N/2.
+ */
+template <typename T, std::size_t N>
+constexpr vector<std::complex<T>, N / 2 + 1> rfft(const vector<T, N> &v) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  COTILA_DETAIL_ASSERT_REAL(T)
+  vector<std::complex<T>, N / 2 + 1> transformed = {};
+  if constexpr (N % 2 == 0) {
+    // Pack even and odd samples as real and imaginary parts, then separate
+    // their transforms using Hermitian symmetry
+    constexpr std::size_t H = N / 2;
+    auto z = detail::fft_vector(generate<H>(
+        [&v](std::size_t n) { return std::complex<T>(v[2 * n], v[2 * n + 1]); }));
+    constexpr auto &w = detail::fft_twiddles<T, N>;
+    for (std::size_t k = 0; k <= H; ++k) {
+      auto a = z[k % H];
+      auto b = cotila::conj(z[(H - k) % H]);
+      auto even = detail::scale(detail::add(a, b), T(0.5));
+      auto d = detail::scale(detail::sub(a, b), T(0.5));
+      std::complex<T> odd = {d.imag(), -d.real()}; // (a - b) / 2i
+      transformed[k] = detail::add(even, detail::mul(odd, w[k]));
+    }
+  } else {
+    auto z = detail::fft_vector(
+        elementwise([](T x) { return std::complex<T>(x); }, v));
+    for (std::size_t k = 0; k <= N / 2; ++k)
+      transformed[k] = z[k];
+  }
+  return transformed;
+}
+
+/** @}*/
+
+} // namespace cotila
+
+#endif // COTILA_SIGNAL_FFT_H_
@@ -0,0 +1,261 @@
+/** @file
+ *  @brief Contains the definitions of the `cotila::fir` and
+ *  `cotila::decimator` filters.
+ */
+
+#ifndef COTILA_SIGNAL_FIR_H_
+#define COTILA_SIGNAL_FIR_H_
+
+#include <cotila/detail/assert.h>
+#include <cotila/vector/vector.h>
+#include <cstddef>
+
+namespace cotila {
+
+/// @private
+namespace detail {
+
+// Number of input samples filtered per pass over the taps
+constexpr std::size_t fir_block = 256;
+
+template <typename T, std::size_t K>
+constexpr vector<T, K> reverse_taps(const vector<T, K> &taps) {
+  vector<T, K> reversed = {};
+  for (std::size_t k = 0; k < K; ++k)
+    reversed[k] = taps[K - 1 - k];
+  return reversed;
+}
+
+} // namespace detail
+
+/** @brief A streaming FIR filter
+ *  @tparam T scalar type of the taps and samples
+ *  @tparam K number of taps
+ *
+ *  `cotila::fir` convolves a stream of samples with a fixed set of taps,
+ *  keeping the last \f$ K - 1 \f$ samples as state between calls so that a
+ *  signal can be filtered in arbitrary pieces.
+ *
+ *  Samples are filtered in blocks copied after the saved state, so that each
+ *  tap is applied to a contiguous run of samples and every output of a block
+ *  is accumulated independently.  This allows the inner loop to be vectorized
+ *  without reassociating floating point sums.
+ *
+ *  The filter can be used at compile time:
+ *  \code{.cpp}
+ *  constexpr auto smoothed = cotila::fir(cotila::vector{0.5, 0.5}).process(cotila::vector{2., 4., 6.});
+ *  static_assert(smoothed == cotila::vector{1., 3., 5.});
+ *  \endcode
+ */
+template <typename T, std::size_t K> class fir {
+  COTILA_DETAIL_ASSERT_ARITHMETIC(T)
+
+public:
+  using value_type = T;
+  static constexpr std::size_t size = K; ///< @brief number of taps
+
+  /** @brief constructs a filter
+   *  @param taps a K-vector of filter taps
+   *
+   *  Constructs a filter with the given taps and zeroed state.
+   */
+  constexpr explicit fir(const vector<T, K> &taps)
+      : reversed(detail::reverse_taps(taps)) {}
+
+  /** @brief returns the filter taps
+   *  @return a K-vector of filter taps
+   */
+  constexpr vector<T, K> taps() const {
+    return detail::reverse_taps(reversed);
+  }
+
+  /** @brief clears the filter state
+   *
+   *  Resets the saved samples to zero, as if the filter was newly constructed.
+   */
+  constexpr void reset() {
+    for (auto &x : history)
+      x = T();
+  }
+
+  /** @brief filters a buffer of samples
+   *  @param in pointer to `n` input samples
+   *  @param out pointer to `n` output samples
+   *  @param n number of samples
+   *
+   *  Filters `n` samples, continuing from the state left by previous calls.
+   *  `in` and `out` may point to the same buffer.
+   */
+  constexpr void process(const T *in, T *out, std::size_t n) {
+    while (n > 0) {
+      std::size_t block = n < detail::fir_block ? n : detail::fir_block;
+      T buffer[H + detail::fir_block] = {};
+      for (std::size_t i = 0; i < H; ++i)
+        buffer[i] = history[i];
+      for (std::size_t i = 0; i < block; ++i)
+        buffer[H + i] = in[i];
+
+      T accumulated[detail::fir_block] = {};
+      for (std::size_t k = 0; k < K; ++k) {
+        const T tap = reversed[k];
+        const T *x = buffer + k + H + 1 - K;
+        for (std::size_t i = 0; i < block; ++i)
+          accumulated[i] += tap * x[i];
+      }
+      for (std::size_t i = 0; i < block; ++i)
+        out[i] = accumulated[i];
+
+      for (std::size_t i = 0; i < H; ++i)
+        history[i] = buffer[block + i];
+      in += block;
+      out += block;
+      n -= block;
+    }
+  }
+
+  /** @brief filters a vector of samples
+   *  @param v an N-vector of input samples
+   *  @return an N-vector of output samples
+   *
+   *  Filters the samples in a vector, continuing from the state left by
+   *  previous calls.
+   */
+  template <std::size_t N> constexpr vector<T, N> process(const vector<T, N> &v) {
+    vector<T, N> filtered = {};
+    process(v.array, filtered.array, N);
+    return filtered;
+  }
+
+  /** @brief filters a single sample
+   *  @param x the input sample
+   *  @return the output sample
+   */
+  constexpr T operator()(T x) {
+    T y = {};
+    process(&x, &y, 1);
+    return y;
+  }
+
+private:
+  // Length of the saved state (at least one, to avoid empty arrays)
+  static constexpr std::size_t H = K > 1 ? K - 1 : 1;
+
+  vector<T, K> reversed;
+  T history[H] = {};
+};
+
+/** @brief A streaming decimating FIR filter
+ *  @tparam T scalar type of the taps and samples
+ *  @tparam K number of taps
+ *  @tparam D decimation factor
+ *
+ *  `cotila::decimator` filters a stream of samples and keeps every Dth
+ *  output.  Only the kept outputs are computed, which makes it equivalent to a
+ *  polyphase decomposition of the filter: each input sample is multiplied by
+ *  about \f$ K / D \f$ taps.  The decimation phase is kept as state between
+ *  calls along with the last \f$ K - 1 \f$ samples.
+ */
+template <typename T, std::size_t K, std::size_t D> class decimator {
+  COTILA_DETAIL_ASSERT_ARITHMETIC(T)
+  static_assert(D != 0, "decimation factor must be positive");
+
+public:
+  using value_type = T;
+  static constexpr std::size_t size = K;     ///< @brief number of taps
+  static constexpr std::size_t factor = D; ///< @brief decimation factor
+
+  /** @brief constructs a filter
+   *  @param taps a K-vector of filter taps
+   *
+   *  Constructs a decimating filter with the given taps and zeroed state.
+   *  The first output is computed from the first input sample.
+   */
+  constexpr explicit decimator(const vector<T, K> &taps)
+      : reversed(detail::reverse_taps(taps)) {}
+
+  /** @brief returns the filter taps
+   *  @return a K-vector of filter taps
+   */
+  constexpr vector<T, K> taps() const {
+    return detail::reverse_taps(reversed);
+  }
+
+  /** @brief clears the filter state
+   *
+   *  Resets the saved samples to zero and the decimation phase to zero, as if
+   *  the filter was newly constructed.
+   */
+  constexpr void reset() {
+    for (auto &x : history)
+      x = T();
+    skip = 0;
+  }
+
+  /** @brief filters and decimates a buffer of samples
+   *  @param in pointer to `n` input samples
+   *  @param out pointer to space for at least \f$ \lceil n / D \rceil \f$
+   *  output samples
+   *  @param n number of input samples
+   *  @return the number of output samples written
+   *
+   *  Filters `n` samples, continuing from the state left by previous calls.
+   */
+  constexpr std::size_t process(const T *in, T *out, std::size_t n) {
+    std::size_t written = 0;
+    while (n > 0) {
+      std::size_t block = n < detail::fir_block ? n : detail::fir_block;
+      T buffer[H + detail::fir_block] = {};
+      for (std::size_t i = 0; i < H; ++i)
+        buffer[i] = history[i];
+      for (std::size_t i = 0; i < block; ++i)
+        buffer[H + i] = in[i];
+
+      // Outputs are produced at inputs skip, skip + D, ...
+      std::size_t outputs = skip < block ? (block - skip + D - 1) / D : 0;
+      T accumulated[detail::fir_block] = {};
+      for (std::size_t k = 0; k < K; ++k) {
+        const T tap = reversed[k];
+        const T *x = buffer + skip + k + H + 1 - K;
+        for (std::size_t j = 0; j < outputs; ++j)
+          accumulated[j] += tap * x[j * D];
+      }
+      for (std::size_t j = 0; j < outputs; ++j)
+        out[written + j] = accumulated[j];
+      written += outputs;
+      skip = skip + outputs * D - block;
+
+      for (std::size_t i = 0; i < H; ++i)
+        history[i] = buffer[block + i];
+      in += block;
+      n -= block;
+    }
+    return written;
+  }
+
+  /** @brief filters and decimates a vector of samples
+   *  @param v an N-vector of input samples, where N is a multiple of D
+   *  @return an N/D-vector of output samples
+   *
+   *  Filters and decimates the samples in a vector, continuing from the state
+   *  left by previous calls.
+   */
+  template <std::size_t N>
+  constexpr vector<T, N / D> process(const vector<T, N> &v) {
+    static_assert(N % D == 0, "vector size must be a multiple of the decimation factor");
+    vector<T, N / D> filtered = {};
+    process(v.array, filtered.array, N);
+    return filtered;
+  }
+
+private:
+  // Length of the saved state (at least one, to avoid empty arrays)
+  static constexpr std::size_t H = K > 1 ? K - 1 : 1;
+
+  vector<T, K> reversed;
+  T history[H] = {};
+  std::size_t skip = 0;
+};
+
+} // namespace cotila
+
+#endif // COTILA_SIGNAL_FIR_H_
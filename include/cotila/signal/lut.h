@@ -0,0 +1,223 @@
+/** @file
+ *  @brief Contains the definition of the `cotila::lut` lookup table.
+ */
+
+#ifndef COTILA_SIGNAL_LUT_H_
+#define COTILA_SIGNAL_LUT_H_
+
+#include <cotila/detail/assert.h>
+#include <cotila/detail/config.h>
+#include <cotila/vector/utility.h>
+#include <cotila/vector/vector.h>
+#include <cstddef>
+#include <type_traits>
+
+namespace cotila {
+
+/// @private
+namespace detail {
+
+// Number of values interpolated per pass
+constexpr std::size_t lut_block = 256;
+
+} // namespace detail
+
+/** @brief Interpolation methods of `cotila::lut`
+ *  \ingroup signal
+ */
+enum class interpolation {
+  linear,  ///< @brief piecewise linear
+  hermite, ///< @brief cubic Hermite, with slopes from central differences
+  spline   ///< @brief natural cubic spline, with continuous second derivative
+};
+
+/** @brief A lookup table interpolating uniformly spaced samples
+ *  @tparam T scalar type of the samples
+ *  @tparam N number of samples
+ *  @tparam I interpolation method
+ *
+ *  `cotila::lut` approximates a function on an interval by N uniformly spaced
+ *  samples.  The interpolating polynomial of each of the \f$ N - 1 \f$
+ *  intervals is computed when the table is constructed, so evaluation is a
+ *  clamp, an index computation and a polynomial of degree one or three, with
+ *  no branches.  Arguments outside of the interval are clamped to it.
+ *
+ *  Tables are usually built at compile time from a function:
+ *  \code{.cpp}
+ *  constexpr auto table = cotila::make_lut<64, cotila::interpolation::spline>(
+ *      [](double x) { return calibration(x); }, 0., 10.);
+ *  double y = table(3.7);
+ *  \endcode
+ */
+template <typename T, std::size_t N,
+          interpolation I = interpolation::linear>
+class lut {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  COTILA_DETAIL_ASSERT_REAL(T)
+  static_assert(N >= 2, "lookup table must contain at least two samples");
+
+public:
+  using value_type = T;
+  static constexpr std::size_t size = N; ///< @brief number of samples
+
+  /** @brief constructs a lookup table
+   *  @param first the position of the first sample
+   *  @param last the position of the last sample
+   *  @param samples an N-vector of samples, spaced uniformly from `first` to
+   *  `last`
+   *
+   *  Throws if `first` is not less than `last`.
+   */
+  constexpr lut(T first, T last, const vector<T, N> &samples)
+      : first(first), last(last), scale(sample_scale(first, last)) {
+    if constexpr (I == interpolation::linear) {
+      for (std::size_t k = 0; k + 1 < N; ++k) {
+        c[0][k] = samples[k];
+        c[1][k] = samples[k + 1] - samples[k];
+      }
+    } else {
+      // Slopes at each sample, per interval
+      T slope[N] = {};
+      if constexpr (I == interpolation::hermite) {
+        slope[0] = samples[1] - samples[0];
+        slope[N - 1] = samples[N - 1] - samples[N - 2];
+        for (std::size_t k = 1; k + 1 < N; ++k)
+          slope[k] = (samples[k + 1] - samples[k - 1]) / T(2);
+      } else {
+        // Second derivatives of the natural spline, from the tridiagonal
+        // system m[k-1] + 4 m[k] + m[k+1] = 6 (y[k+1] - 2 y[k] + y[k-1])
+        // with m[0] = m[N-1] = 0, solved by forward elimination and back
+        // substitution
+        T m[N] = {}, diagonal[N] = {}, rhs[N] = {};
+        for (std::size_t k = 1; k + 1 < N; ++k) {
+          diagonal[k] = T(4);
+          rhs[k] = T(6) * (samples[k + 1] - T(2) * samples[k] + samples[k - 1]);
+          if (k > 1) {
+            T factor = T(1) / diagonal[k - 1];
+            diagonal[k] -= factor;
+            rhs[k] -= factor * rhs[k - 1];
+          }
+        }
+        for (std::size_t k = N - 1; k-- > 1;)
+          m[k] = (rhs[k] - m[k + 1]) / diagonal[k];
+        for (std::size_t k = 0; k + 1 < N; ++k)
+          slope[k] = samples[k + 1] - samples[k] - (T(2) * m[k] + m[k + 1]) / T(6);
+        slope[N - 1] = samples[N - 1] - samples[N - 2] +
+                       (m[N - 2] + T(2) * m[N - 1]) / T(6);
+      }
+
+      // Cubic Hermite polynomial of each interval
+      for (std::size_t k = 0; k + 1 < N; ++k) {
+        T dy = samples[k + 1] - samples[k];
+        c[0][k] = samples[k];
+        c[1][k] = slope[k];
+        c[2][k] = T(3) * dy - T(2) * slope[k] - slope[k + 1];
+        c[3][k] = slope[k] + slope[k + 1] - T(2) * dy;
+      }
+    }
+  }
+
+  /** @brief interpolates a value
+   *  @param x the argument
+   *  @return the interpolated value at x, clamped to the table's interval
+   */
+  constexpr T operator()(T x) const {
+    // Written in the form of min and max instructions, so that evaluation
+    // compiles without branches
+    x = first < x ? x : first;
+    x = x < last ? x : last;
+    T u = (x - first) * scale;
+    // Converting to a signed index avoids the branches of unsigned conversion
+    int k = static_cast<int>(u);
+    k = k < int(N - 2) ? k : int(N - 2);
+    T t = u - T(k);
+    if constexpr (I == interpolation::linear)
+      return c[0][k] + t * c[1][k];
+    else
+      return c[0][k] + t * (c[1][k] + t * (c[2][k] + t * c[3][k]));
+  }
+
+  /** @brief interpolates a buffer of values
+   *  @param in pointer to `n` arguments
+   *  @param out pointer to `n` interpolated values
+   *  @param n number of values
+   *
+   *  Interpolates each of the arguments.  Values are interpolated in blocks
+   *  into a local buffer, which cannot alias the table, so that the loop can
+   *  be vectorized.  `in` and `out` may point to the same buffer.
+   */
+  constexpr void operator()(const T *in, T *out, std::size_t n) const {
+    while (n > 0) {
+      std::size_t block = n < detail::lut_block ? n : detail::lut_block;
+      T interpolated[detail::lut_block] = {};
+      for (std::size_t i = 0; i < block; ++i)
+        interpolated[i] = (*this)(in[i]);
+      for (std::size_t i = 0; i < block; ++i)
+        out[i] = interpolated[i];
+      in += block;
+      out += block;
+      n -= block;
+    }
+  }
+
+  /** @brief interpolates a vector of values
+   *  @param v an M-vector of arguments
+   *  @return an M-vector of interpolated values
+   */
+  template <std::size_t M>
+  constexpr vector<T, M> operator()(const vector<T, M> &v) const {
+    vector<T, M> interpolated = {};
+    (*this)(v.array, interpolated.array, M);
+    return interpolated;
+  }
+
+  /** @brief returns the position of the first sample
+   *  @return the lower end of the interval
+   */
+  constexpr T lower() const { return first; }
+
+  /** @brief returns the position of the last sample
+   *  @return the upper end of the interval
+   */
+  constexpr T upper() const { return last; }
+
+private:
+  // Samples per unit of the argument, for an interval that must not be empty
+  static constexpr T sample_scale(T first, T last) {
+    if (!(first < last))
+      COTILA_DETAIL_THROW("lookup table interval must be increasing");
+    return T(N - 1) / (last - first);
+  }
+
+  // Polynomial coefficients of each interval, in powers of the position
+  // within the interval, stored by power so that each is contiguous
+  static constexpr std::size_t degree = I == interpolation::linear ? 1 : 3;
+
+  T first, last, scale;
+  T c[degree + 1][N - 1] = {};
+};
+
+/** \addtogroup signal
+ *  @{
+ */
+
+/** @brief constructs a lookup table from a function
+ *  @tparam N number of samples
+ *  @tparam I interpolation method
+ *  @param f a function of type F that operates on a scalar of type T
+ *  @param first the lower end of the interval
+ *  @param last the upper end of the interval
+ *  @return a lookup table of N samples of f, spaced uniformly from `first` to
+ *  `last`
+ */
+template <std::size_t N, interpolation I = interpolation::linear, typename F,
+          typename T>
+constexpr lut<T, N, I> make_lut(F &&f, T first, T last) {
+  return lut<T, N, I>(first, last, elementwise(f, linspace<N>(first, last)));
+}
+
+/** @}*/
+
+} // namespace cotila
+
+#endif // COTILA_SIGNAL_LUT_H_
@@ -0,0 +1,100 @@
+/** @file
+ *  @brief Window functions and filter design.
+ */
+
+#ifndef COTILA_SIGNAL_WINDOW_H_
+#define COTILA_SIGNAL_WINDOW_H_
+
+#include <cotila/detail/assert.h>
+#include <cotila/scalar/math.h>
+#include <cotila/vector/math.h>
+#include <cotila/vector/operators.h>
+#include <cotila/vector/utility.h>
+#include <cotila/vector/vector.h>
+#include <cstddef>
+
+namespace cotila {
+
+/// @private
+namespace detail {
+
+// Generalized cosine window with coefficients a0 - a1 cos(x) + a2 cos(2x)
+template <std::size_t N, typename T>
+constexpr vector<T, N> cosine_window(double a0, double a1, double a2) {
+  constexpr double two_pi = 6.283185307179586;
+  if constexpr (N == 1)
+    return {T(1)};
+  else
+    return generate<N>([a0, a1, a2](std::size_t n) {
+      double x = two_pi * n / (N - 1);
+      return T(a0 - a1 * cotila::cos(x) + a2 * cotila::cos(2 * x));
+    });
+}
+
+} // namespace detail
+
+/** \addtogroup signal
+ *  @{
+ */
+
+/** @brief generates a Hann window
+ *  @return an N-vector \f$ \textbf{w} \f$ of type T such that
+ *  \f$ \textbf{w}_n = 0.5 - 0.5 \cos\left(\frac{2 \pi n}{N - 1}\right) \f$
+ *
+ *  Generates a symmetric Hann window.
+ */
+template <std::size_t N, typename T = double> constexpr vector<T, N> hann() {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  return detail::cosine_window<N, T>(0.5, 0.5, 0.);
+}
+
+/** @brief generates a Hamming window
+ *  @return an N-vector \f$ \textbf{w} \f$ of type T such that
+ *  \f$ \textbf{w}_n = 0.54 - 0.46 \cos\left(\frac{2 \pi n}{N - 1}\right) \f$
+ *
+ *  Generates a symmetric Hamming window.
+ */
+template <std::size_t N, typename T = double> constexpr vector<T, N> hamming() {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  return detail::cosine_window<N, T>(0.54, 0.46, 0.);
+}
+
+/** @brief generates a Blackman window
+ *  @return an N-vector \f$ \textbf{w} \f$ of type T such that
+ *  \f$ \textbf{w}_n = 0.42 - 0.5 \cos\left(\frac{2 \pi n}{N - 1}\right) + 0.08 \cos\left(\frac{4 \pi n}{N - 1}\right) \f$
+ *
+ *  Generates a symmetric Blackman window.
+ */
+template <std::size_t N, typename T = double>
+constexpr vector<T, N> blackman() {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  return detail::cosine_window<N, T>(0.42, 0.5, 0.08);
+}
+
+/** @brief designs a lowpass filter
+ *  @param cutoff the cutoff frequency, in cycles per sample (between 0 and 0.5)
+ *  @param window an N-vector of type T to taper the filter with
+ *  @return an N-vector of type T containing the filter taps
+ *
+ *  Designs a linear phase lowpass FIR filter with the windowed sinc method.
+ *  The taps are normalized to unity gain at DC.
+ */
+template <std::size_t N, typename T>
+constexpr vector<T, N> lowpass(T cutoff, const vector<T, N> &window = hamming<N, T>()) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  COTILA_DETAIL_ASSERT_REAL(T)
+  constexpr double pi = 3.141592653589793;
+  auto taps = generate<N>([cutoff, &window](std::size_t n) {
+    double t = double(n) - double(N - 1) / 2;
+    double x = 2 * pi * double(cutoff) * t;
+    double sinc = t == 0 ? 1. : cotila::sin(x) / x;
+    return T(sinc * window[n]);
+  });
+  return taps * (T(1) / sum(taps));
+}
+
+/** @}*/
+
+} // namespace cotila
+
+#endif // COTILA_SIGNAL_WINDOW_H_
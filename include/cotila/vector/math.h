@@ -5,13 +5,126 @@
 #ifndef COTILA_VECTOR_MATH_H_
 #define COTILA_VECTOR_MATH_H_
 
+#include <cotila/detail/assert.h>
+#include <cotila/detail/config.h>
+#include <cotila/detail/complex.h>
 #include <cotila/detail/type_traits.h>
 #include <cotila/vector/utility.h>
 #include <cotila/vector/vector.h>
 #include <cotila/scalar/math.h>
+#include <cmath>
+#include <cstddef>
+#include <limits>
 
 namespace cotila {
 
+/// @private
+namespace detail {
+
+// Number of independent partial sums in reductions, so that they can be
+// vectorized without reassociating floating point additions
+constexpr std::size_t reduce_lanes = 4;
+
+// Sum of f(i) for i in [0, n)
+template <typename R, typename F>
+constexpr R lane_sum(std::size_t n, F f) {
+  R partial[reduce_lanes] = {};
+  std::size_t i = 0;
+  for (; i + reduce_lanes <= n; i += reduce_lanes)
+    for (std::size_t l = 0; l < reduce_lanes; ++l)
+      partial[l] += f(i + l);
+  for (std::size_t l = 0; i < n; ++i, ++l)
+    partial[l] += f(i);
+  R total = partial[0];
+  for (std::size_t l = 1; l < reduce_lanes; ++l)
+    total += partial[l];
+  return total;
+}
+
+// Largest absolute value of the real and imaginary parts, which bounds the
+// magnitude of each element to within a factor of sqrt(2) without a sqrt
+template <typename T> constexpr remove_complex_t<T> max_part(const T &x) {
+  if constexpr (is_complex_v<T>) {
+    auto re = x.real() < 0 ? -x.real() : x.real();
+    auto im = x.imag() < 0 ? -x.imag() : x.imag();
+    return re < im ? im : re;
+  } else {
+    return x < 0 ? -x : x;
+  }
+}
+
+// Whether the real or imaginary part is NaN
+template <typename T> constexpr bool has_nan(const T &x) {
+  if constexpr (is_complex_v<T>)
+    return x.real() != x.real() || x.imag() != x.imag();
+  else
+    return x != x;
+}
+
+// Exponent e such that x = m 2^e with m in [0.5, 1), for positive finite x
+template <typename R> constexpr int exponent(R x) {
+  int e = 0;
+  if (!COTILA_DETAIL_IS_CONSTANT_EVALUATED()) {
+    std::frexp(x, &e);
+    return e;
+  }
+  for (; x >= 1; x /= 2)
+    ++e;
+  for (; x < R(0.5); x *= 2)
+    --e;
+  return e;
+}
+
+// 2^e, for e within the range of normal exponents of R
+template <typename R> constexpr R power_of_two(int e) {
+  if (!COTILA_DETAIL_IS_CONSTANT_EVALUATED())
+    return std::ldexp(R(1), e);
+  R p = 1;
+  for (; e > 0; --e)
+    p *= 2;
+  for (; e < 0; ++e)
+    p /= 2;
+  return p;
+}
+
+// Euclidean norm of f(0), ..., f(n - 1).  The squares are summed directly
+// when they can neither overflow nor underflow, and otherwise after scaling
+// by a power of two near the reciprocal of the largest element, which is
+// exact.  The scale is applied in two halves, since the reciprocal of a
+// subnormal element is not representable.  The norm is NaN if any element is
+// NaN, and otherwise infinite if any element is infinite.
+template <typename T, typename F>
+constexpr remove_complex_t<T> scaled_norm2(std::size_t n, F f) {
+  using R = remove_complex_t<T>;
+  constexpr R small = cotila::sqrt(std::numeric_limits<R>::min());
+  constexpr R big = cotila::sqrt(std::numeric_limits<R>::max()) / 4;
+  R largest = 0;
+  bool nan = false;
+  for (std::size_t i = 0; i < n; ++i) {
+    auto y = f(i);
+    nan = nan | has_nan(y);
+    R x = max_part(y);
+    largest = x > largest ? x : largest;
+  }
+  if (nan)
+    return std::numeric_limits<R>::quiet_NaN();
+  if (largest > std::numeric_limits<R>::max())
+    return std::numeric_limits<R>::infinity();
+  if (largest == 0)
+    return 0;
+  if (largest >= small && largest * R(n) <= big)
+    return cotila::sqrt(
+        lane_sum<R>(n, [&f](std::size_t i) { return abs2(f(i)); }));
+  const int e = exponent(largest);
+  const R s1 = power_of_two<R>(-(e / 2)), s2 = power_of_two<R>(e / 2 - e);
+  R norm = cotila::sqrt(lane_sum<R>(n, [&f, s1, s2](std::size_t i) {
+    return abs2(scale(scale(f(i), s1), s2));
+  }));
+  return norm * power_of_two<R>(e / 2) * power_of_two<R>(e - e / 2);
+}
+
+} // namespace detail
+
 /** \addtogroup vector
  *  @{
  */
@@ -100,6 +213,48 @@ template <typename T, std::size_t N> constexpr T sum(const vector<T, N> &v) {
   return accumulate(v, static_cast<T>(0), std::plus<T>());
 }
 
+/** @brief computes the cumulative sum
+ *  @param v an N-vector of type T
+ *  @return an N-vector \f$ \textbf{r} \f$ of type T such that
+ *  \f$ \textbf{r}_i = \sum\limits_{j \le i} \textbf{v}_j \f$
+ *
+ *  Computes the cumulative sum of the elements of a vector.  The elements are
+ *  summed in order, so each element is rounded exactly as by a sequential
+ *  loop.
+ */
+template <typename T, std::size_t N>
+constexpr vector<T, N> cumsum(const vector<T, N> &v) {
+  return inclusive_scan(v, [](const T &a, const T &b) { return detail::add(a, b); });
+}
+
+/** @brief computes the cumulative product
+ *  @param v an N-vector of type T
+ *  @return an N-vector \f$ \textbf{r} \f$ of type T such that
+ *  \f$ \textbf{r}_i = \prod\limits_{j \le i} \textbf{v}_j \f$
+ *
+ *  Computes the cumulative product of the elements of a vector, in order.
+ */
+template <typename T, std::size_t N>
+constexpr vector<T, N> cumprod(const vector<T, N> &v) {
+  return inclusive_scan(v, [](const T &a, const T &b) { return detail::mul(a, b); });
+}
+
+/** @brief computes the differences between consecutive elements
+ *  @param v an N-vector of type T
+ *  @return an \f$ \left(N - 1\right) \f$-vector \f$ \textbf{r} \f$ of type T
+ *  such that \f$ \textbf{r}_i = \textbf{v}_{i+1} - \textbf{v}_i \f$
+ *
+ *  Computes the differences between consecutive elements of a vector, the
+ *  inverse of `cotila::cumsum` (excluding the first element).
+ */
+template <typename T, std::size_t N>
+constexpr vector<T, N - 1> diff(const vector<T, N> &v) {
+  vector<T, N - 1> r = {};
+  for (std::size_t i = 0; i + 1 < N; ++i)
+    r[i] = detail::sub(v[i + 1], v[i]);
+  return r;
+}
+
 /** @brief computes the minimum valued element
  *  @param v an N-vector of type T
  *  @return a scalar \f$ v_i \f$ of type T where \f$ v_i \leq v_j,\ \forall j \f$
@@ -159,6 +314,151 @@ constexpr std::size_t max_index(const vector<T, N> &v) {
   return index;
 }
 
+/** @brief computes the Euclidean norm
+ *  @param v an N-vector of floating point type T
+ *  @return a scalar \f$ {\left\lVert \textbf{v} \right\rVert}_2 =
+ *  \sqrt{\sum\limits_{i} \lvert v_i \rvert^2} \f$ of the real type of T
+ *
+ *  Computes the Euclidean (L2) norm of a vector.  The elements are scaled when
+ *  necessary so that the result does not overflow or underflow unless the
+ *  norm itself does.
+ */
+template <typename T, std::size_t N>
+constexpr detail::remove_complex_t<T> norm2(const vector<T, N> &v) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  return detail::scaled_norm2<T>(N, [&v](std::size_t i) { return v[i]; });
+}
+
+/** @brief computes the sum of magnitudes
+ *  @param v an N-vector of type T
+ *  @return a scalar \f$ {\left\lVert \textbf{v} \right\rVert}_1 =
+ *  \sum\limits_{i} \lvert v_i \rvert \f$ of the real type of T
+ *
+ *  Computes the L1 norm of a vector.
+ */
+template <typename T, std::size_t N>
+constexpr detail::remove_complex_t<T> norm1(const vector<T, N> &v) {
+  return detail::lane_sum<detail::remove_complex_t<T>>(
+      N, [&v](std::size_t i) { return abs(v[i]); });
+}
+
+/** @brief computes the largest magnitude
+ *  @param v an N-vector of type T
+ *  @return a scalar \f$ {\left\lVert \textbf{v} \right\rVert}_\infty =
+ *  \max\limits_{i} \lvert v_i \rvert \f$ of the real type of T
+ *
+ *  Computes the maximum (L-infinity) norm of a vector.
+ */
+template <typename T, std::size_t N>
+constexpr detail::remove_complex_t<T> norminf(const vector<T, N> &v) {
+  if constexpr (detail::is_complex_v<T>) {
+    // Compare squared magnitudes, and take a single square root
+    detail::remove_complex_t<T> largest = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+      auto x = detail::abs2(v[i]);
+      largest = x > largest ? x : largest;
+    }
+    return sqrt(largest);
+  } else {
+    return max(abs(v));
+  }
+}
+
+/** @brief normalizes a vector
+ *  @param v a nonzero N-vector of floating point type T
+ *  @return an N-vector \f$ \frac{\textbf{v}}{{\left\lVert \textbf{v}
+ *  \right\rVert}_2} \f$ of type T
+ *
+ *  Scales a vector to unit Euclidean norm.
+ */
+template <typename T, std::size_t N>
+constexpr vector<T, N> normalize(const vector<T, N> &v) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  auto n = norm2(v);
+  if (n == 0)
+    COTILA_DETAIL_THROW("cannot normalize a zero vector");
+  auto s = 1 / n;
+  return elementwise([s](const T &x) { return detail::scale(x, s); }, v);
+}
+
+/** @brief computes the squared Euclidean distance
+ *  @param a an N-vector of type T
+ *  @param b an N-vector of type T
+ *  @return a scalar \f$ \sum\limits_{i} \lvert a_i - b_i \rvert^2 \f$ of the
+ *  real type of T
+ *
+ *  Computes the squared Euclidean distance between two vectors.
+ */
+template <typename T, std::size_t N>
+constexpr detail::remove_complex_t<T> squared_distance(const vector<T, N> &a,
+                                                       const vector<T, N> &b) {
+  return detail::lane_sum<detail::remove_complex_t<T>>(
+      N, [&a, &b](std::size_t i) { return detail::abs2(detail::sub(a[i], b[i])); });
+}
+
+/** @brief computes the L1 distance
+ *  @param a an N-vector of type T
+ *  @param b an N-vector of type T
+ *  @return a scalar \f$ \sum\limits_{i} \lvert a_i - b_i \rvert \f$ of the
+ *  real type of T
+ *
+ *  Computes the L1 (Manhattan) distance between two vectors.
+ */
+template <typename T, std::size_t N>
+constexpr detail::remove_complex_t<T> l1_distance(const vector<T, N> &a,
+                                                  const vector<T, N> &b) {
+  return detail::lane_sum<detail::remove_complex_t<T>>(
+      N, [&a, &b](std::size_t i) { return abs(detail::sub(a[i], b[i])); });
+}
+
+/** @brief computes the cosine distance
+ *  @param a a nonzero N-vector of real floating point type T
+ *  @param b a nonzero N-vector of real floating point type T
+ *  @return a scalar \f$ 1 - \frac{\textbf{a} \cdot \textbf{b}}{{\left\lVert
+ *  \textbf{a} \right\rVert}_2 {\left\lVert \textbf{b} \right\rVert}_2} \f$
+ *  of type T
+ *
+ *  Computes the cosine distance between two vectors, which is between 0 for
+ *  vectors in the same direction and 2 for vectors in opposite directions.
+ */
+template <typename T, std::size_t N>
+constexpr T cosine_distance(const vector<T, N> &a, const vector<T, N> &b) {
+  COTILA_DETAIL_ASSERT_FLOATING_POINT(T)
+  COTILA_DETAIL_ASSERT_REAL(T)
+  auto ab = detail::lane_sum<T>(N, [&a, &b](std::size_t i) { return a[i] * b[i]; });
+  auto na = norm2(a), nb = norm2(b);
+  if (na == 0 || nb == 0)
+    COTILA_DETAIL_THROW("cosine distance is undefined for a zero vector");
+  return 1 - (ab / na) / nb;
+}
+
+/** @brief finds the nearest of a set of points
+ *  @param q an N-vector of type T
+ *  @param points pointer to `count` N-vectors of type T
+ *  @param count number of points, at least one
+ *  @return the index of the point with the smallest Euclidean distance to
+ *  \f$ \textbf{q} \f$
+ *
+ *  Searches a buffer of points for the nearest to a query point, by squared
+ *  Euclidean distance.  Ties are resolved in favor of the lowest index.
+ */
+template <typename T, std::size_t N>
+constexpr std::size_t nearest(const vector<T, N> &q,
+                              const vector<T, N> *points, std::size_t count) {
+  if (count == 0)
+    COTILA_DETAIL_THROW("no points to search");
+  std::size_t index = 0;
+  auto best = squared_distance(q, points[0]);
+  for (std::size_t p = 1; p < count; ++p) {
+    auto d = squared_distance(q, points[p]);
+    if (d < best) {
+      best = d;
+      index = p;
+    }
+  }
+  return index;
+}
+
 /** @}*/
 
 } // namespace cotila
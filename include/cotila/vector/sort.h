@@ -0,0 +1,234 @@
+/** @file
+ *  @brief Sorting and selection of vectors with sorting networks.
+ */
+
+#ifndef COTILA_VECTOR_SORT_H_
+#define COTILA_VECTOR_SORT_H_
+
+#include <array>
+#include <cotila/detail/assert.h>
+#include <cotila/vector/vector.h>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace cotila {
+
+/// @private
+namespace detail {
+
+struct comparator {
+  std::size_t first, second;
+};
+
+// Calls f(i, j) for each comparator of Batcher's merge exchange sorting
+// network for n elements (Knuth, TAOCP vol. 3, algorithm 5.2.2M).  Comparators
+// within a round touch distinct elements, so they are independent.
+template <typename F> constexpr void merge_exchange(std::size_t n, F f) {
+  if (n < 2)
+    return;
+  std::size_t t = 1;
+  while ((std::size_t(1) << t) < n)
+    ++t;
+  for (std::size_t p = std::size_t(1) << (t - 1); p > 0; p >>= 1) {
+    std::size_t q = std::size_t(1) << (t - 1), r = 0, d = p;
+    while (true) {
+      for (std::size_t i = 0; i + d < n; ++i)
+        if ((i & p) == r)
+          f(i, i + d);
+      if (q == p)
+        break;
+      d = q - p;
+      q >>= 1;
+      r = p;
+    }
+  }
+}
+
+template <std::size_t N> constexpr std::size_t sorting_network_size() {
+  std::size_t size = 0;
+  merge_exchange(N, [&size](std::size_t, std::size_t) { ++size; });
+  return size;
+}
+
+template <std::size_t N>
+constexpr std::array<comparator, sorting_network_size<N>()>
+make_sorting_network() {
+  std::array<comparator, sorting_network_size<N>()> network = {};
+  std::size_t k = 0;
+  merge_exchange(N, [&network, &k](std::size_t i, std::size_t j) {
+    network[k++] = {i, j};
+  });
+  return network;
+}
+
+// The network sorting N elements
+template <std::size_t N>
+constexpr auto sorting_network = make_sorting_network<N>();
+
+// Marks the comparators of the sorting network that can affect the elements
+// at positions K...
+template <std::size_t N, std::size_t... K>
+constexpr std::array<bool, sorting_network_size<N>()> selection_mask() {
+  constexpr auto &network = sorting_network<N>;
+  std::array<bool, sorting_network_size<N>()> mask = {};
+  bool needed[N] = {};
+  ((needed[K] = true), ...);
+  for (std::size_t k = network.size(); k-- > 0;) {
+    auto c = network[k];
+    if (needed[c.first] || needed[c.second]) {
+      mask[k] = true;
+      needed[c.first] = needed[c.second] = true;
+    }
+  }
+  return mask;
+}
+
+template <std::size_t N, std::size_t... K>
+constexpr std::size_t selection_network_size() {
+  std::size_t size = 0;
+  for (bool keep : selection_mask<N, K...>())
+    size += keep;
+  return size;
+}
+
+template <std::size_t N, std::size_t... K>
+constexpr std::array<comparator, selection_network_size<N, K...>()>
+make_selection_network() {
+  std::array<comparator, selection_network_size<N, K...>()> network = {};
+  auto mask = selection_mask<N, K...>();
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < mask.size(); ++i)
+    if (mask[i])
+      network[k++] = sorting_network<N>[i];
+  return network;
+}
+
+// The comparators of the sorting network needed to place the elements at
+// positions K...
+template <std::size_t N, std::size_t... K>
+constexpr auto selection_network = make_selection_network<N, K...>();
+
+// Orders a pair of elements.  Both selections use the same comparison, so the
+// pair is only ever exchanged (even for unordered values such as NaN), and
+// compile to blends without branches.
+template <typename T> constexpr void compare_exchange(T &a, T &b) {
+  bool swap = b < a;
+  T lo = swap ? b : a;
+  T hi = swap ? a : b;
+  a = lo;
+  b = hi;
+}
+
+// Applies a network with constant indices, so that the comparators can be
+// scheduled and vectorized
+template <const auto &Network, typename T, std::size_t N, std::size_t... I>
+constexpr vector<T, N> apply_network(vector<T, N> v,
+                                     std::index_sequence<I...>) {
+  (compare_exchange(v[Network[I].first], v[Network[I].second]), ...);
+  return v;
+}
+
+template <const auto &Network, typename T, std::size_t N>
+constexpr vector<T, N> apply_network(const vector<T, N> &v) {
+  return apply_network<Network>(
+      v, std::make_index_sequence<std::size(Network)>());
+}
+
+} // namespace detail
+
+/** \addtogroup vector
+ *  @{
+ */
+
+/** @brief sorts a vector
+ *  @param v an N-vector of type T
+ *  @return an N-vector containing the elements of \f$ \textbf{v} \f$ in
+ *  ascending order
+ *
+ *  Sorts a vector with a sorting network generated at compile time (Batcher's
+ *  merge exchange), which performs a fixed sequence of comparisons without
+ *  branching on the values.  The result is always a permutation of the
+ *  elements, but the order is unspecified if any of them is NaN.
+ */
+template <typename T, std::size_t N>
+constexpr vector<T, N> sort(const vector<T, N> &v) {
+  COTILA_DETAIL_ASSERT_REAL(T)
+  return detail::apply_network<detail::sorting_network<N>>(v);
+}
+
+/** @brief computes the indices that sort a vector
+ *  @param v an N-vector of type T
+ *  @return an N-vector of indices \f$ \textbf{i} \f$ such that
+ *  \f$ \textbf{v}_{\textbf{i}_0} \le \textbf{v}_{\textbf{i}_1} \le \ldots \f$
+ *
+ *  Computes the indices that sort a vector, using the same sorting network as
+ *  `cotila::sort`.  Equal elements keep their original order.
+ */
+template <typename T, std::size_t N>
+constexpr vector<std::size_t, N> argsort(const vector<T, N> &v) {
+  COTILA_DETAIL_ASSERT_REAL(T)
+  vector<std::size_t, N> indices = {};
+  for (std::size_t i = 0; i < N; ++i)
+    indices[i] = i;
+  for (const auto &c : detail::sorting_network<N>) {
+    auto &a = indices[c.first];
+    auto &b = indices[c.second];
+    bool swap = v[b] < v[a] || (!(v[a] < v[b]) && b < a);
+    auto lo = swap ? b : a;
+    auto hi = swap ? a : b;
+    a = lo;
+    b = hi;
+  }
+  return indices;
+}
+
+/** @brief selects the nth smallest element of a vector
+ *  @tparam K the position of the element in sorted order
+ *  @param v an N-vector of type T
+ *  @return the element at position K of `cotila::sort(v)`
+ *
+ *  Selects an element of a vector by its rank, using only the comparators of
+ *  the sorting network that determine position K.
+ */
+template <std::size_t K, typename T, std::size_t N>
+constexpr T nth_element(const vector<T, N> &v) {
+  COTILA_DETAIL_ASSERT_REAL(T)
+  static_assert(K < N, "position must be less than the size of the vector");
+  return detail::apply_network<detail::selection_network<N, K>>(v)[K];
+}
+
+/** @brief computes the median of a vector
+ *  @param v an N-vector of type T
+ *  @return the middle element of `cotila::sort(v)`, or the mean of the two
+ *  middle elements if N is even
+ *
+ *  Computes the median of a vector, using only the comparators of the sorting
+ *  network that determine the middle elements.  For even N and integral types,
+ *  the mean is rounded toward the smaller element, and does not overflow.
+ */
+template <typename T, std::size_t N>
+constexpr T median(const vector<T, N> &v) {
+  COTILA_DETAIL_ASSERT_REAL(T)
+  if constexpr (N % 2 == 1) {
+    return detail::apply_network<detail::selection_network<N, N / 2>>(v)[N / 2];
+  } else {
+    auto sorted = detail::apply_network<
+        detail::selection_network<N, N / 2 - 1, N / 2>>(v);
+    auto lo = sorted[N / 2 - 1], hi = sorted[N / 2];
+    // Halving the difference, which is computed unsigned, avoids overflow of
+    // the sum
+    if constexpr (std::is_integral_v<T>) {
+      using U = std::make_unsigned_t<T>;
+      return lo + T(U(U(hi) - U(lo)) / U(2));
+    } else
+      return (lo + hi) / T(2);
+  }
+}
+
+/** @}*/
+
+} // namespace cotila
+
+#endif // COTILA_VECTOR_SORT_H_
@@ -47,6 +47,44 @@ constexpr U accumulate(const vector<T, N> &v, U init, F &&f) {
   return r;
 }
 
+/** @brief computes the inclusive prefix scan of a vector
+ *  @param v an N-vector of type T
+ *  @param f a function of type F that operates between two elements of type T
+ *  @return an N-vector \f$ \textbf{r} \f$ of type T such that
+ *  \f$ \textbf{r}_1 = \textbf{v}_1 \f$ and
+ *  \f$ \textbf{r}_i = f\left(\textbf{r}_{i-1}, \textbf{v}_i\right) \f$
+ *
+ *  Computes the running fold of an operation over the elements, including
+ *  each element in its own result.
+ */
+template <typename T, std::size_t N, typename F>
+constexpr vector<T, N> inclusive_scan(const vector<T, N> &v, F &&f) {
+  vector<T, N> r = v;
+  for (std::size_t i = 1; i < N; ++i)
+    r[i] = std::apply(std::forward<F>(f), std::forward_as_tuple(r[i - 1], v[i]));
+  return r;
+}
+
+/** @brief computes the exclusive prefix scan of a vector
+ *  @param v an N-vector of type T
+ *  @param init the initial value
+ *  @param f a function of type F that operates between U and vector elements of type T
+ *  @return an N-vector \f$ \textbf{r} \f$ of type U such that
+ *  \f$ \textbf{r}_1 = \textrm{init} \f$ and
+ *  \f$ \textbf{r}_i = f\left(\textbf{r}_{i-1}, \textbf{v}_{i-1}\right) \f$
+ *
+ *  Computes the running fold of an operation over the elements, excluding
+ *  each element from its own result.
+ */
+template <typename T, std::size_t N, typename U, typename F>
+constexpr vector<U, N> exclusive_scan(const vector<T, N> &v, U init, F &&f) {
+  vector<U, N> r = {};
+  r[0] = init;
+  for (std::size_t i = 1; i < N; ++i)
+    r[i] = std::apply(std::forward<F>(f), std::forward_as_tuple(r[i - 1], v[i - 1]));
+  return r;
+}
+
 /** @brief casts a vector to another type
  *  @param v an N-vector of type U
  *  @return an N-vector of type T containing the casted elements of \f$ \textbf{v} \f$
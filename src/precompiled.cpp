@@ -0,0 +1,5 @@
+// Explicit instantiations for the `cotila::precompiled` library.
+
+#include <cotila/cotila.h>
+
+COTILA_DETAIL_PRECOMPILED(template)
@@ -0,0 +1,33 @@
+#include "baked/constants.h"
+#include <complex>
+#include <cotila/cotila.h>
+#include <cstdint>
+#include <iostream>
+
+namespace cotila {
+namespace test {
+
+static_assert(baked::m22_inverse == inverse(matrix{{{1., 3.}, {2., 7.}}}),
+              "baked matrix");
+
+static_assert(baked::ramp == linspace<5>(0.f, 1.f), "baked vector");
+
+static_assert(baked::root == sqrt(2.), "baked scalar");
+
+static_assert(baked::complex_identity == identity<std::complex<double>, 2>,
+              "baked complex matrix");
+
+static_assert(baked::integers == iota<4>(-2), "baked integer vector");
+
+} // namespace test
+} // namespace cotila
+
+int main() {
+  if (reinterpret_cast<std::uintptr_t>(&cotila::test::baked::m22_inverse) % 64) {
+    std::cout << "Baked constants are not aligned." << std::endl;
+    return 1;
+  }
+  std::cout << "This program was built successfully, indicating all baked "
+               "constants match their expressions."
+            << std::endl;
+}
@@ -0,0 +1,89 @@
+#ifndef COTILA_COST_TEST_H_
+#define COTILA_COST_TEST_H_
+
+#include <complex>
+#include <cotila/cotila.h>
+
+namespace cotila {
+namespace test {
+
+using a23 = matrix<double, 2, 3>;
+using a34 = matrix<double, 3, 4>;
+using c33 = matrix<std::complex<double>, 3, 3>;
+
+static_assert(cost<op::matmul, a23, a34>::flops == 2 * 4 * (3 + 2),
+              "matmul flops");
+static_assert(cost<op::matmul, a23, a34>::bytes_read == (6 + 12) * 8,
+              "matmul bytes read");
+static_assert(cost<op::matmul, a23, a34>::bytes_written == 8 * 8,
+              "matmul bytes written");
+static_assert(cost<op::matmul, c33, c33>::flops == 9 * (3 * 6 + 2 * 2),
+              "complex matmul flops");
+
+// One level of Strassen-Winograd above the cutoff
+static_assert(cost<op::matmul, matrix<double, 2 * COTILA_STRASSEN_CUTOFF,
+                                      2 * COTILA_STRASSEN_CUTOFF>,
+                   matrix<double, 2 * COTILA_STRASSEN_CUTOFF,
+                          2 * COTILA_STRASSEN_CUTOFF>>::flops ==
+                  7 * cost<op::matmul,
+                           matrix<double, COTILA_STRASSEN_CUTOFF,
+                                  COTILA_STRASSEN_CUTOFF>,
+                           matrix<double, COTILA_STRASSEN_CUTOFF,
+                                  COTILA_STRASSEN_CUTOFF>>::flops +
+                      15 * COTILA_STRASSEN_CUTOFF * COTILA_STRASSEN_CUTOFF,
+              "Strassen-Winograd matmul flops");
+
+// Odd dimensions are peeled
+static_assert(detail::count_matmul(5, 5, 5, 2).muls ==
+                      7 * detail::count_matmul(2, 2, 2, 2).muls + 4 * 4 + 25 +
+                          4 * 5 &&
+                  detail::count_matmul(5, 5, 5, 2).adds ==
+                      7 * detail::count_matmul(2, 2, 2, 2).adds +
+                          15 * 4 + 4 * 4 + 5 * 4 + 4 * 4,
+              "Strassen-Winograd matmul peeling");
+
+static_assert(cost<op::matvec, a23, vector<double, 3>>::flops == 2 * (3 + 2),
+              "matvec flops");
+
+static_assert(cost<op::det, matrix<double, 2, 2>>::flops ==
+                  2 * (2 + 1 * 2 * 2) + 2,
+              "det flops");
+static_assert(cost<op::det, matrix<double, 2, 2>>::bytes_written == 8,
+              "det bytes written");
+static_assert(cost<op::inverse, matrix<double, 2, 2>>::flops ==
+                  (3 + 2) + (3 + 2) * 2,
+              "inverse flops");
+static_assert(cost<op::det, matrix<int, 3, 3>>::flops == (4 + 1) * 4,
+              "integer det flops");
+static_assert(cost<op::inverse, matrix<double, 4, 4>>::flops >
+                  cost<op::det, matrix<double, 4, 4>>::flops,
+              "inverse is more expensive than det");
+
+static_assert(cost<op::kron, a23, a34>::flops == 72, "kron flops");
+static_assert(cost<op::kron, a23, a34>::bytes_written == 72 * 8,
+              "kron bytes written");
+
+static_assert(cost<op::transpose, a23>::flops == 0, "transpose flops");
+
+static_assert(cost<op::elementwise, vector<float, 4>, vector<float, 4>>::flops ==
+                  4,
+              "elementwise flops");
+static_assert(cost<op::elementwise, vector<float, 4>, vector<float, 4>>::
+                      bytes_read == 32,
+              "elementwise bytes read");
+static_assert(cost<op::elementwise, a23, double>::bytes_read == 7 * 8,
+              "elementwise broadcast bytes read");
+static_assert(cost<op::elementwise, vector<std::complex<float>, 4>>::flops ==
+                  8,
+              "unary elementwise flops");
+
+static_assert(cost<op::sum, vector<double, 8>>::flops == 7, "sum flops");
+static_assert(cost<op::max, vector<int, 8>>::bytes_read == 32,
+              "max bytes read");
+static_assert(cost<op::dot, vector<double, 8>, vector<double, 8>>::flops == 15,
+              "dot flops");
+
+} // namespace test
+} // namespace cotila
+
+#endif // COTILA_COST_TEST_H_
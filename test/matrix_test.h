@@ -2,6 +2,8 @@
 #define COTILA_MATRIX_TEST_H_
 
 #include <complex>
+#include <functional>
+#include <limits>
 #include <cotila/cotila.h>
 
 namespace cotila {
@@ -90,6 +92,37 @@ static_assert(kron(m2, m2) ==
                 matrix{{{1., 2., 2., 4.}}},
               "kron");
 
+constexpr matrix<double, 2, 3> ka = {{{1., 2., 0.}, {-1., 3., 1.}}};
+constexpr matrix<double, 3, 2> kb = {{{2., 1.}, {0., -1.}, {1., 4.}}};
+constexpr vector<double, 6> kx = {1., -2., 3., 0.5, -1., 2.};
+
+static_assert(kron_apply(ka, kb, kx) == matvec(kron(ka, kb), kx),
+              "kron_apply");
+
+static_assert(kron_apply(kb, ka, kx) == matvec(kron(kb, ka), kx),
+              "kron_apply");
+
+static_assert(kron_view(ka, kb)(4, 3) == kron(ka, kb)[4][3], "kron_view");
+
+static_assert(matvec(kron_view(kb, ka), kx) == matvec(kron(kb, ka), kx),
+              "kron_view matvec");
+
+static_assert(matmul(kron_view(ka, kb), submat<6, 2>(kron(ka, kb), 0, 1)) ==
+                  matmul(kron(ka, kb), submat<6, 2>(kron(ka, kb), 0, 1)),
+              "kron_view matmul");
+
+static_assert(matmul(submat<3, 6>(kron(kb, ka), 2, 0), kron_view(ka, kb)) ==
+                  matmul(submat<3, 6>(kron(kb, ka), 2, 0), kron(ka, kb)),
+              "kron_view matmul");
+
+constexpr matrix<std::complex<double>, 2, 2> kc = {
+    {{{1., 1.}, {0., 2.}}, {{-1., 0.}, {3., -1.}}}};
+constexpr vector<std::complex<double>, 4> kcx = {
+    {{1., 0.}, {0., 1.}, {2., -1.}, {-1., 0.}}};
+
+static_assert(kron_apply(kc, kc, kcx) == matvec(kron(kc, kc), kcx),
+              "complex kron_apply");
+
 static_assert(identity<double, 3> == inverse(identity<double, 3>), "inverse-identity");
 
 static_assert(inverse(m22) ==
@@ -102,25 +135,168 @@ static_assert(matmul(inverse(m22), matrix<double, 2, 1>{{{1.},{1.}}}) ==
                 matrix{{{4.}, {-1.}}},
                 "A^-1*b = x");
 
+static_assert(!try_inverse(m1), "try_inverse of a singular matrix");
+
+static_assert(!try_inverse(matrix<double, 2, 2>{}),
+              "try_inverse of the zero matrix");
+
+static_assert(*try_inverse(m22) == inverse(m22), "try_inverse");
+
+static_assert(*try_inverse(matrix{{{0., 2.}, {4., 0.}}}) ==
+                  matrix{{{0., 0.25}, {0.5, 0.}}},
+              "try_inverse with row exchange");
+
+// Entries of the rescaled pivot row are far below the singularity tolerance
+// of the original matrix, but must still be eliminated
+static_assert(inverse(matrix{{{0x1p56, -0x1p55}, {0., 0x1p56}}}) ==
+                  matrix{{{0x1p-56, 0x1p-57}, {0., 0x1p-56}}},
+              "inverse of a matrix with large elements");
+
+// The largest pivot is chosen, not the first larger one, which would be
+// negligible here
+static_assert(try_inverse(matrix{{{1e-17, 1., 0.}, {2e-17, 0., 1.}, {1., 1., 1.}}})
+                  .has_value(),
+              "try_inverse with partial pivoting");
+
 static_assert(trace(m1) == 15, "matrix trace");
 
+static_assert(matpow(matrix{{{1, 1}, {1, 0}}}, 10) == matrix{{{89, 55}, {55, 34}}},
+              "matpow");
+
+static_assert(matpow(m1, 0) == identity<double, 3> && matpow(m1, 1) == m1 &&
+                  matpow(m1, 3) == matmul(m1, matmul(m1, m1)),
+              "matpow");
+
+static_assert(matpow(matrix{{{0., 2.}, {4., 0.}}}, -2) ==
+                  matrix{{{0.125, 0.}, {0., 0.125}}},
+              "matpow with negative exponent");
+
+static_assert(matpow(matrix{{{1., 0.}, {0., -1.}}},
+                     std::numeric_limits<int>::min()) == identity<double, 2>,
+              "matpow with the most negative exponent");
+
+template <typename T, std::size_t M>
+constexpr bool near_matrix(const matrix<T, M, M> &a, const matrix<T, M, M> &b,
+                           double tolerance = 1e-12) {
+  for (std::size_t i = 0; i < M; ++i)
+    for (std::size_t j = 0; j < M; ++j)
+      if (detail::abs2(detail::sub(a[i][j], b[i][j])) > tolerance * tolerance)
+        return false;
+  return true;
+}
+
+static_assert(near_matrix(expm(matrix<double, 3, 3>{}), identity<double, 3>),
+              "expm of zero");
+
+static_assert(near_matrix(expm(matrix{{{0., 1.}, {0., 0.}}}),
+                          matrix{{{1., 1.}, {0., 1.}}}),
+              "expm of a nilpotent matrix");
+
+static_assert(near_matrix(expm(matrix{{{1., 0.}, {0., -2.}}}),
+                          matrix{{{2.718281828459045, 0.},
+                                  {0., 0.1353352832366127}}}),
+              "expm of a diagonal matrix");
+
+// Rotation by 10 radians, which requires scaling and squaring
+static_assert(near_matrix(expm(matrix{{{0., -10.}, {10., 0.}}}),
+                          matrix{{{-0.8390715290764524, 0.5440211108893698},
+                                  {-0.5440211108893698, -0.8390715290764524}}},
+                          1e-11),
+              "expm of a skew-symmetric matrix");
+
+static_assert(near_matrix(expm(matrix<std::complex<double>, 2, 2>{
+                              {{{0., 3.14159265358979323846}, {0., 0.}},
+                               {{0., 0.}, {0., 0.}}}}),
+                          matrix<std::complex<double>, 2, 2>{
+                              {{{-1., 0.}, {0., 0.}}, {{0., 0.}, {1., 0.}}}}),
+              "complex expm");
+
+constexpr matrix<double, 3, 3> spd = {
+    {{4., 1., 0.}, {1., 3., 1.}, {0., 1., 2.}}};
+
+static_assert(near_matrix(sqrtm(matrix{{{4., 0.}, {0., 9.}}}),
+                          matrix{{{2., 0.}, {0., 3.}}}),
+              "sqrtm of a diagonal matrix");
+
+static_assert(near_matrix(matmul(sqrtm(spd), sqrtm(spd)), spd), "sqrtm");
+
+static_assert(logm(identity<double, 3>) == matrix<double, 3, 3>{},
+              "logm of identity");
+
+static_assert(near_matrix(logm(matrix{{{2.718281828459045, 0.},
+                                       {0., 7.38905609893065}}}),
+                          matrix{{{1., 0.}, {0., 2.}}}),
+              "logm of a diagonal matrix");
+
+static_assert(near_matrix(logm(expm(matrix{{{0.5, 1., 0.}, {-1., 0.2, 0.3}, {0., 0.1, -0.4}}})),
+                          matrix{{{0.5, 1., 0.}, {-1., 0.2, 0.3}, {0., 0.1, -0.4}}}),
+              "logm of expm");
+
 static_assert(horzcat(identity<double, 2>, identity<double, 2>) ==
                 matrix<double, 2, 4>{{{1., 0., 1., 0.}, {0., 1., 0., 1.}}}, "horzcat");
 
 static_assert(vertcat(identity<double, 2>, identity<double, 2>) ==
                 matrix<double, 4, 2>{{{1., 0.}, {0., 1.}, {1., 0.}, {0., 1.}}}, "vertcat");
 
+static_assert(swaprow(matrix{{{1, 2, 3}, {4, 5, 6}}}, 0, 1) ==
+                  matrix{{{4, 5, 6}, {1, 2, 3}}},
+              "swaprow");
+
+static_assert(swapcol(matrix{{{1, 2, 3}, {4, 5, 6}}}, 0, 2) ==
+                  matrix{{{3, 2, 1}, {6, 5, 4}}},
+              "swapcol");
+
+constexpr bool check_swap_in_place() {
+  matrix<int, 3, 3> m = {{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}};
+  m.swaprow(0, 2).swapcol(0, 1);
+  return m == matrix{{{8, 7, 9}, {5, 4, 6}, {2, 1, 3}}};
+}
+
+static_assert(check_swap_in_place(), "swaprow and swapcol in place");
+
+constexpr permutation<3> p3(vector<std::size_t, 3>{2, 0, 1});
+
+static_assert(permute(vector{1., 2., 3.}, p3) == vector{3., 1., 2.},
+              "permute vector");
+
+static_assert(permute<axis::row>(m1, p3) == matmul(as_matrix<double>(p3), m1),
+              "permute rows");
+
+static_assert(permute<axis::column>(m1, p3) ==
+                  matrix{{{3., 1., 2.}, {6., 4., 5.}, {9., 7., 8.}}},
+              "permute columns");
+
+static_assert(compose(p3, inverse(p3)) == permutation<3>(), "inverse permutation");
+
+static_assert(permute(vector{1., 2., 3.}, compose(p3, permutation<3>().swap(0, 1))) ==
+                  permute(permute(vector{1., 2., 3.}, permutation<3>().swap(0, 1)), p3),
+              "compose permutations");
+
+static_assert(permute<axis::row>(m1, permutation<3>().swap(0, 2)) ==
+                  swaprow(m1, 0, 2),
+              "permutation swap");
+
+static_assert(p3.sign() == 1 && permutation<3>().swap(0, 2).sign() == -1 &&
+                  permutation<4>().swap(0, 1).swap(2, 3).sign() == 1,
+              "permutation sign");
+
+static_assert(det(as_matrix<int>(permutation<5>().swap(0, 4).swap(1, 3).swap(3, 2))) ==
+                  permutation<5>().swap(0, 4).swap(1, 3).swap(3, 2).sign(),
+              "permutation sign");
+
 static_assert(submat<2, 2>(m1, 1, 1) == matrix{{{5., 6.}, {8., 9.}}}, "submat");
 
 static_assert(macs(m1) == 18, "maximum absolute value column sum norm");
 
 static_assert(mars(m1) == 24, "maximum absolute value row sum norm");
 
-static_assert(rref(m1) ==
-                matrix{
-                {{1., 0., -1.},
-                 {0., 1., 2.},
-                 {0., 0., 0.}}},
+static_assert(normfro(matrix{{{1., 2.}, {2., 4.}}}) == 5, "Frobenius norm");
+
+// Partial pivoting reorders the rows, so the result is rounded
+static_assert(normfro(elementwise(std::minus<>(), rref(m1),
+                                  matrix{{{1., 0., -1.},
+                                          {0., 1., 2.},
+                                          {0., 0., 0.}}})) < 1e-14,
                 "rref");
 
 static_assert(rank(m1) == 2, "rank");
@@ -129,6 +305,52 @@ static_assert(det(m1) == 0, "det");
 
 static_assert(det(m22) == 1, "det");
 
+static_assert(det(matrix{{{2., 0.}, {0., 3.}}}) == 6, "det");
+
+static_assert(det(matrix{{{0., 1., 0.}, {2., 0., 0.}, {0., 0., 4.}}}) == -8,
+              "det with row exchange");
+
+// The largest pivot is chosen, not the first larger one, which would be
+// negligible here
+static_assert(rank(matrix{{{1e-17, 1., 0.}, {2e-17, 0., 1.}, {1., 1., 1.}}}) == 3,
+              "rank with partial pivoting");
+
+static_assert(rank(matrix<double, 2, 3>{}) == 0 &&
+                  det(matrix<double, 2, 2>{}) == 0 &&
+                  rref(matrix<double, 2, 2>{}, 0.) == matrix<double, 2, 2>{},
+              "rank, det and rref of the zero matrix");
+
+static_assert(rank(matrix{{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}}) == 2,
+              "integer rank");
+
+static_assert(rank(matrix{{{0, 0, 1, 2}, {0, 0, 2, 4}, {0, 3, 0, 1}}}) == 2,
+              "integer rank with zero columns");
+
+static_assert(det(matrix{{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}}) == 0,
+              "integer det");
+
+static_assert(det(matrix{{{0, 1, 0}, {2, 0, 0}, {0, 0, 4}}}) == -8,
+              "integer det with row exchange");
+
+static_assert(det(matrix{{{2, -1, 0, 0},
+                          {-1, 2, -1, 0},
+                          {0, -1, 2, -1},
+                          {0, 0, -1, 2}}}) == 5,
+              "integer det");
+
+// Not exactly representable as a double
+static_assert(det(matrix<long long, 2, 2>{
+                  {{3037000499LL, 1LL}, {2LL, 3037000499LL}}}) ==
+                  9223372030926249001LL - 2LL,
+              "exact integer det");
+
+// Products of minors exceed long long, but the determinant does not
+static_assert(det(matrix<long long, 3, 3>{{{3037000499LL, 0LL, 0LL},
+                                           {0LL, 3037000499LL, 0LL},
+                                           {0LL, 0LL, 1LL}}}) ==
+                  9223372030926249001LL,
+              "integer det with wide intermediates");
+
 static_assert(reshape<1, 9>(m1) == matrix<double, 1, 9>{
         {{1., 2., 3., 4., 5., 6., 7., 8., 9.}}}, "reshape");
 
@@ -143,6 +365,240 @@ static_assert(imag(m1c) == matrix{{{1., 0., 0.},
                                    {1., 0., 0.},
                                    {1., 0., 0.}}}, "imag");
 
+constexpr matrix<double, 2, 3> m23 = {{{1., 2., 3.}, {4., 5., 6.}}};
+
+static_assert(matvec(m23, vector{1., 0., -1.}) == vector{-2., -2.}, "matvec");
+
+static_assert(matvec_t(m23, vector{1., -1.}) == vector{-3., -3., -3.},
+              "matvec_t");
+
+static_assert(vecmat(vector{1., -1.}, m23) == vector{-3., -3., -3.}, "vecmat");
+
+static_assert(matvec_h(m1c, vector<std::complex<double>, 3>{{1., 0., 0.}}) ==
+                  vector{{{1., -1.}, {2., 0.}, {3., 0.}}},
+              "matvec_h");
+
+static_assert(matvec(m1c, vector<std::complex<double>, 3>{{{0., 1.}, 0., 0.}}) ==
+                  vector{{{-1., 1.}, {-1., 4.}, {-1., 7.}}},
+              "complex matvec");
+
+static_assert(gemv(2., m23, vector{1., 0., -1.}, -1., vector{1., 2.}) ==
+                  vector{-5., -6.},
+              "gemv");
+
+static_assert(broadcast<axis::row>(std::plus<>(), m23, vector{10., 20.}) ==
+                  matrix{{{11., 12., 13.}, {24., 25., 26.}}},
+              "row broadcast");
+
+static_assert(broadcast<axis::column>(std::plus<>(), m23,
+                                      vector{10., 20., 30.}) ==
+                  matrix{{{11., 22., 33.}, {14., 25., 36.}}},
+              "column broadcast");
+
+static_assert(m23 + along<axis::column>(vector{1., 1., 1.}) == m23 + 1.,
+              "broadcast sum");
+
+static_assert(m23 - along<axis::row>(vector{1., 4.}) ==
+                  matrix{{{0., 1., 2.}, {0., 1., 2.}}},
+              "broadcast difference");
+
+static_assert(m23 * along<axis::column>(vector{2., 1., 0.}) ==
+                  matrix{{{2., 2., 0.}, {8., 5., 0.}}},
+              "broadcast product");
+
+static_assert(m23 / along<axis::row>(vector{1., 2.}) ==
+                  matrix{{{1., 2., 3.}, {2., 2.5, 3.}}},
+              "broadcast quotient");
+
+static_assert(sum<axis::row>(m23) == vector{6., 15.}, "row sums");
+
+static_assert(sum<axis::column>(m23) == vector{5., 7., 9.}, "column sums");
+
+static_assert(min<axis::row>(m22) == vector{1., 2.}, "row minimums");
+
+static_assert(max<axis::column>(m22) == vector{2., 7.}, "column maximums");
+
+static_assert(norm<axis::column>(matrix{{{3., 0.}, {-4., 2.}}}) ==
+                  vector{5., 2.},
+              "column norms");
+
+static_assert(norm<axis::row>(matrix<std::complex<double>, 1, 2>{
+                  {{{3., 4.}, {0., 0.}}}}) == vector{5.},
+              "complex row norms");
+
+static_assert(mean<axis::row>(m23) == vector{2., 5.}, "row means");
+
+static_assert(mean<axis::column>(m23) == vector{2.5, 3.5, 4.5},
+              "column means");
+
+constexpr matrix<std::complex<double>, 2, 2> m22c = {
+    {{{3., 4.}, {0., 1.}}, {{0., 0.}, {1., 0.}}}};
+
+static_assert(macs(m22c) == 5., "complex maximum absolute column sum norm");
+
+static_assert(mars(m22c) == 6., "complex maximum absolute row sum norm");
+
+static_assert(normfro(m22c) == cotila::sqrt(27.), "complex Frobenius norm");
+
+constexpr matrix<std::complex<double>, 2, 2> m22c2 = {
+    {{{1., 1.}, {2., 0.}}, {{3., 0.}, {4., -1.}}}};
+
+static_assert(detail::abs2(detail::sub(det(m22c2), {-1., 3.})) < 1e-28,
+              "complex det");
+
+static_assert(rank(m22c2) == 2, "complex rank");
+
+static_assert(rank(matrix<std::complex<double>, 2, 2>{
+                  {{{1., 1.}, {2., 0.}}, {{0., 2.}, {2., 2.}}}}) == 1,
+              "complex rank");
+
+static_assert(
+    [] {
+      auto e = matmul(m22c2, inverse(m22c2));
+      for (std::size_t i = 0; i < 2; ++i)
+        for (std::size_t j = 0; j < 2; ++j)
+          if (detail::abs2(detail::sub(e[i][j], {i == j ? 1. : 0., 0.})) >
+              1e-28)
+            return false;
+      return true;
+    }(),
+    "complex inverse");
+
+static_assert(rref(m22c2, 0.5) == identity<std::complex<double>, 2>,
+              "complex rref with tolerance");
+
+static_assert(detail::matrix_chain_v<matrix<double, 10, 30>,
+                                     matrix<double, 30, 5>,
+                                     matrix<double, 5, 60>>.split[0][2] == 1,
+              "matrix chain order (AB)C");
+
+static_assert(detail::matrix_chain_v<matrix<double, 1, 64>,
+                                     matrix<double, 64, 64>,
+                                     matrix<double, 64, 64>,
+                                     matrix<double, 64, 1>>.split[0][3] == 0,
+              "matrix chain order A(BCD)");
+
+static_assert(detail::matrix_chain_v<matrix<double, 64, 1>,
+                                     matrix<double, 1, 64>,
+                                     matrix<double, 64, 64>,
+                                     matrix<double, 64, 1>>.split[0][3] == 0 &&
+                  detail::matrix_chain_v<matrix<double, 64, 1>,
+                                         matrix<double, 1, 64>,
+                                         matrix<double, 64, 64>,
+                                         matrix<double, 64, 1>>.split[1][3] == 1,
+              "matrix chain order A(B(CD))");
+
+static_assert(multi_matmul(m23, transpose(m23), m23) ==
+                  matmul(matmul(m23, transpose(m23)), m23),
+              "multi_matmul");
+
+static_assert(multi_matmul(m1) == m1, "multi_matmul");
+
+template <std::size_t M, std::size_t N>
+constexpr matrix<long, M, N> test_matrix(long seed) {
+  return generate<M, N>([seed](std::size_t i, std::size_t j) {
+    return long((seed + 7 * i + 3 * j + i * j) % 11) - 5;
+  });
+}
+
+// Strassen-Winograd is exact for integers, so compare against the direct
+// algorithm with small cutoffs
+static_assert(detail::matmul_impl<1>(test_matrix<8, 8>(1),
+                                     test_matrix<8, 8>(2)) ==
+                  matmul(test_matrix<8, 8>(1), test_matrix<8, 8>(2)),
+              "Strassen-Winograd matmul");
+
+static_assert(detail::matmul_impl<2>(test_matrix<7, 9>(3),
+                                     test_matrix<9, 5>(4)) ==
+                  matmul(test_matrix<7, 9>(3), test_matrix<9, 5>(4)),
+              "Strassen-Winograd matmul with odd dimensions");
+
+static_assert(detail::matmul_impl<1>(test_matrix<11, 6>(5),
+                                     test_matrix<6, 13>(6)) ==
+                  matmul(test_matrix<11, 6>(5), test_matrix<6, 13>(6)),
+              "Strassen-Winograd matmul with odd dimensions");
+
+static_assert(matmul(test_matrix<3, 70>(7), test_matrix<70, 130>(8))[2][129] ==
+                  [] {
+                    auto a = test_matrix<3, 70>(7);
+                    auto b = test_matrix<70, 130>(8);
+                    long x = 0;
+                    for (std::size_t k = 0; k < 70; ++k)
+                      x += a[2][k] * b[k][129];
+                    return x;
+                  }(),
+              "blocked matmul");
+
+static_assert(outer(vector{1., 2.}, vector{1., 0., -1.}) ==
+                  matrix{{{1., 0., -1.}, {2., 0., -2.}}},
+              "outer");
+
+static_assert([] {
+  auto a = m23;
+  ger(a, 2., vector{1., -1.}, vector{1., 0., 1.});
+  return a;
+}() == matrix{{{3., 2., 5.}, {2., 5., 4.}}},
+              "ger");
+
+static_assert(syrk(m23) == matmul(m23, transpose(m23)), "syrk");
+
+static_assert(syrk_t(m23) == matmul(transpose(m23), m23), "syrk_t");
+
+constexpr matrix<double, 3, 4> affine = {
+    {{0., -1., 0., 1.},
+     {1., 0., 0., 2.},
+     {0., 0., 2., 3.}}};
+
+// More points than a single transform block
+constexpr bool check_transform() {
+  constexpr std::size_t count = 21;
+  vector<double, 3> in[count] = {};
+  double interleaved[3 * count] = {};
+  for (std::size_t p = 0; p < count; ++p)
+    for (std::size_t j = 0; j < 3; ++j)
+      interleaved[3 * p + j] = in[p][j] = double(p * 3 + j);
+
+  vector<double, 2> out[count] = {};
+  vector<double, 3> affine_out[count] = {};
+  double interleaved_out[2 * count] = {};
+  double interleaved_affine_out[3 * count] = {};
+  constexpr matrix<double, 2, 3> linear = {{{1., 2., 3.}, {0., -1., 1.}}};
+  transform(linear, in, out, count);
+  transform_affine(affine, in, affine_out, count);
+  transform(linear, interleaved, interleaved_out, count);
+  transform_affine(affine, interleaved, interleaved_affine_out, count);
+
+  for (std::size_t p = 0; p < count; ++p) {
+    auto x = in[p];
+    vector<double, 2> expected = {x[0] + 2 * x[1] + 3 * x[2], x[2] - x[1]};
+    vector<double, 3> expected_affine = {1. - x[1], x[0] + 2., 2 * x[2] + 3.};
+    if (out[p] != expected || affine_out[p] != expected_affine)
+      return false;
+    for (std::size_t i = 0; i < 2; ++i)
+      if (interleaved_out[2 * p + i] != expected[i])
+        return false;
+    for (std::size_t i = 0; i < 3; ++i)
+      if (interleaved_affine_out[3 * p + i] != expected_affine[i])
+        return false;
+  }
+  return true;
+}
+
+static_assert(check_transform(), "transform");
+
+constexpr bool check_complex_transform() {
+  using C = std::complex<double>;
+  constexpr matrix<C, 2, 3> affine = {
+      {{{0., 1.}, {0., 0.}, {1., 0.}}, {{0., 0.}, {2., 0.}, {0., -1.}}}};
+  vector<C, 2> in[2] = {{{{1., 0.}, {0., 1.}}}, {{{2., 2.}, {-1., 0.}}}};
+  vector<C, 2> out[2] = {};
+  transform_affine(affine, in, out, 2);
+  return out[0] == vector<C, 2>{{{1., 1.}, {0., 1.}}} &&
+         out[1] == vector<C, 2>{{{-1., 2.}, {-2., -1.}}};
+}
+
+static_assert(check_complex_transform(), "complex transform");
+
 } // namespace test
 } // namespace cotila
 
@@ -0,0 +1,23 @@
+import cotila;
+
+#include <iostream>
+
+namespace cotila {
+namespace test {
+
+static_assert(matmul(identity<double, 2>, matrix{{{1., 2.}, {3., 4.}}}) ==
+                  matrix{{{1., 2.}, {3., 4.}}},
+              "module matrix");
+
+static_assert(sum(vector{1, 2, 3}) == 6, "module vector");
+
+static_assert(sqrt(625.) == 25, "module scalar");
+
+} // namespace test
+} // namespace cotila
+
+int main() {
+  std::cout << "This program was built successfully, indicating the cotila "
+               "module can be imported."
+            << std::endl;
+}
@@ -0,0 +1,109 @@
+#ifndef COTILA_POLYNOMIAL_TEST_H_
+#define COTILA_POLYNOMIAL_TEST_H_
+
+#include <complex>
+#include <cotila/cotila.h>
+
+namespace cotila {
+namespace test {
+
+// (x - 1)(x - 2)(x - 3)
+constexpr polynomial<double, 4> cubic_poly(vector{-6., 11., -6., 1.});
+
+static_assert(cubic_poly(0.) == -6. && cubic_poly(2.) == 0. && cubic_poly(4.) == 6.,
+              "polynomial evaluation");
+
+static_assert(cubic_poly(vector{1., 3., 5.}) == vector{0., 0., 24.},
+              "polynomial vector evaluation");
+
+static_assert(derivative(cubic_poly).coefficients() == vector{11., -12., 3.},
+              "polynomial derivative");
+
+static_assert(polynomial<std::complex<double>, 3>(vector<std::complex<double>, 3>{
+                  {{1., 0.}, {0., 1.}, {1., 0.}}})({0., 1.}) == std::complex<double>(-1., 0.),
+              "complex polynomial evaluation");
+
+template <std::size_t N>
+constexpr bool near_coefficients(const vector<double, N> &a,
+                                 const vector<double, N> &b) {
+  for (std::size_t i = 0; i < N; ++i)
+    if (detail::abs2(a[i] - b[i]) > 1e-20)
+      return false;
+  return true;
+}
+
+// Exact fit through samples of the cubic
+static_assert(near_coefficients(
+                  polyfit<4>(linspace<7>(-1., 5.), cubic_poly(linspace<7>(-1., 5.)))
+                      .coefficients(),
+                  cubic_poly.coefficients()),
+              "polyfit");
+
+// Least squares line through symmetric noise
+static_assert(near_coefficients(polyfit<2>(vector{0., 1., 2., 3.},
+                                           vector{1.1, 2.9, 5.1, 6.9})
+                                    .coefficients(),
+                                vector{1.06, 1.96}),
+              "polyfit least squares");
+
+// Exact line in long double
+constexpr auto line_ld = polyfit<2>(vector{0.L, 1.L, 2.L, 3.L},
+                                    vector{1.L / 7, 1.L / 7 + 1.L / 3,
+                                           1.L / 7 + 2.L / 3, 1.L / 7 + 1.L})
+                             .coefficients();
+
+static_assert(cotila::abs(line_ld[0] - 1.L / 7) < 1e-17L &&
+                  cotila::abs(line_ld[1] - 1.L / 3) < 1e-17L,
+              "polyfit in long double");
+
+// Checks that each expected root is near one of the computed roots
+template <std::size_t N>
+constexpr bool has_roots(const vector<std::complex<double>, N> &computed,
+                         const vector<std::complex<double>, N> &expected,
+                         double tolerance = 1e-18) {
+  for (std::size_t i = 0; i < N; ++i) {
+    bool found = false;
+    for (std::size_t j = 0; j < N; ++j)
+      found = found || detail::abs2(detail::sub(computed[j], expected[i])) < tolerance;
+    if (!found)
+      return false;
+  }
+  return true;
+}
+
+static_assert(has_roots(roots(cubic_poly), vector<std::complex<double>, 3>{
+                                               {1., 2., 3.}}),
+              "polynomial roots");
+
+static_assert(has_roots(roots(polynomial<double, 3>(vector{1., 0., 1.})),
+                        vector<std::complex<double>, 2>{{{0., 1.}, {0., -1.}}}),
+              "complex roots");
+
+// x^5 - 1
+static_assert(has_roots(roots(polynomial<double, 6>(vector{-1., 0., 0., 0., 0., 1.})),
+                        generate<5>([](std::size_t k) {
+                          double angle = 2 * 3.14159265358979323846 * k / 5;
+                          return std::complex<double>(cotila::cos(angle),
+                                                      cotila::sin(angle));
+                        })),
+              "roots of unity");
+
+// 2 (x - 0.5)^2 (x + 4)
+static_assert(has_roots(roots(polynomial<double, 4>(vector{2., -7.5, 6., 2.})),
+                        vector<std::complex<double>, 3>{{0.5, 0.5, -4.}}, 1e-14),
+              "repeated roots");
+
+// x^2 - 2 in long double
+constexpr auto sqrt2_roots =
+    roots(polynomial<long double, 3>(vector{-2.L, 0.L, 1.L}));
+
+static_assert(cotila::abs(cotila::abs(sqrt2_roots[0].real()) -
+                          1.41421356237309504880168872420969808L) < 1e-18L &&
+                  cotila::abs(sqrt2_roots[0].real() + sqrt2_roots[1].real()) <
+                      1e-18L,
+              "roots in long double");
+
+} // namespace test
+} // namespace cotila
+
+#endif // COTILA_POLYNOMIAL_TEST_H_
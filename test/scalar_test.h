@@ -3,6 +3,7 @@
 
 #include <complex>
 #include <cotila/cotila.h>
+#include <limits>
 
 namespace cotila {
 namespace test {
@@ -11,10 +12,48 @@ static_assert(sqrt(625.) == 25, "sqrt");
 
 static_assert(sqrt(625.f) == 25, "sqrt");
 
+static_assert(sqrt(0.) == 0, "sqrt of zero");
+
 static_assert(exponentiate(5.5, 2) == 30.25, "exponentiate");
 
 static_assert(nthroot(27, 3) == 3, "nth root");
 
+static_assert(cotila::sin(0.) == 0., "sin");
+
+static_assert(cotila::cos(0.) == 1., "cos");
+
+static_assert(cotila::abs(cotila::sin(0.5235987755982988) - 0.5) < 1e-15, "sin");
+
+static_assert(cotila::abs(cotila::cos(2.0943951023931953) + 0.5) < 1e-15, "cos");
+
+static_assert(cotila::abs(cotila::sin(-100.) - 0.5063656411097588) < 1e-14, "sin");
+
+static_assert(cotila::abs(cotila::cos(-100.) - 0.8623188722876839) < 1e-14, "cos");
+
+static_assert(cotila::abs(cotila::sin(1e5) - 0.03574879797201651) < 1e-15, "sin");
+
+static_assert(cotila::abs(cotila::cos(800000.) - 0.959365532058978) < 1e-15, "cos");
+
+static_assert(cotila::abs(cotila::sin(0.5L) -
+                          0.479425538604203000273287935215571388L) < 1e-18L,
+              "sin in long double");
+
+static_assert(cotila::abs(cotila::cos(-100.L) -
+                          0.862318872287683920656875386981262317L) < 1e-16L,
+              "cos in long double");
+
+static_assert(cotila::sin(std::numeric_limits<double>::quiet_NaN()) !=
+                  cotila::sin(std::numeric_limits<double>::quiet_NaN()),
+              "sin of NaN");
+
+static_assert(cotila::sin(std::numeric_limits<double>::infinity()) !=
+                  cotila::sin(std::numeric_limits<double>::infinity()),
+              "sin of infinity");
+
+static_assert(cotila::cos(-std::numeric_limits<double>::infinity()) !=
+                  cotila::cos(-std::numeric_limits<double>::infinity()),
+              "cos of infinity");
+
 static_assert(cotila::abs(std::complex(3., 4.)) == 5., "abs");
 
 static_assert(cotila::abs(-4) == 4, "abs");
@@ -0,0 +1,178 @@
+#ifndef COTILA_SIGNAL_TEST_H_
+#define COTILA_SIGNAL_TEST_H_
+
+#include <complex>
+#include <cotila/cotila.h>
+
+namespace cotila {
+namespace test {
+
+template <typename T, std::size_t N>
+constexpr bool near(const vector<T, N> &a, const vector<T, N> &b,
+                    double tolerance = 1e-12) {
+  for (std::size_t i = 0; i < N; ++i)
+    if (detail::abs2(detail::sub(a[i], b[i])) > tolerance * tolerance)
+      return false;
+  return true;
+}
+
+// Direct evaluation of the DFT definition
+template <std::size_t N>
+constexpr vector<std::complex<double>, N>
+dft(const vector<std::complex<double>, N> &v) {
+  constexpr double two_pi = 6.283185307179586;
+  return generate<N>([&v](std::size_t k) {
+    std::complex<double> x = {};
+    for (std::size_t n = 0; n < N; ++n) {
+      double angle = -two_pi * double((k * n) % N) / N;
+      x = detail::add(
+          x, detail::mul(v[n], std::complex<double>(cotila::cos(angle),
+                                                    cotila::sin(angle))));
+    }
+    return x;
+  });
+}
+
+template <std::size_t N>
+constexpr vector<std::complex<double>, N> signal = generate<N>([](std::size_t n) {
+  return std::complex<double>(double(n % 7) - 2.5, double((3 * n) % 5) - 1.);
+});
+
+static_assert(fft(vector<std::complex<double>, 4>{{1., 2., 3., 4.}}) ==
+                  vector<std::complex<double>, 4>{
+                      {{10., 0.}, {-2., 2.}, {-2., 0.}, {-2., -2.}}},
+              "fft");
+
+static_assert(fft(vector<std::complex<double>, 8>{{1.}}) ==
+                  fill<8>(std::complex<double>(1.)),
+              "fft impulse");
+
+static_assert(near(fft(signal<64>), dft(signal<64>)), "fft radix-4");
+
+static_assert(near(fft(signal<32>), dft(signal<32>)), "fft radix-2");
+
+static_assert(near(fft(signal<12>), dft(signal<12>)), "fft mixed radix");
+
+static_assert(near(fft(signal<5>), dft(signal<5>)), "fft small prime");
+
+static_assert(near(fft(signal<17>), dft(signal<17>)), "fft bluestein");
+
+static_assert(near(fft(signal<34>), dft(signal<34>)), "fft mixed radix bluestein");
+
+static_assert(cotila::abs(detail::unit_root<long double>(1, 8).real() -
+                          0.707106781186547524400844362104849039L) < 1e-18L,
+              "twiddles in long double");
+
+static_assert(near(ifft(fft(signal<17>)), signal<17>), "ifft");
+
+static_assert(near(ifft(fft(signal<24>)), signal<24>), "ifft");
+
+static_assert(near(rfft(real(signal<16>)), slice<9>(fft(elementwise(
+                  [](double x) { return std::complex<double>(x); },
+                  real(signal<16>))))),
+              "rfft even");
+
+static_assert(near(rfft(real(signal<9>)), slice<5>(fft(elementwise(
+                  [](double x) { return std::complex<double>(x); },
+                  real(signal<9>))))),
+              "rfft odd");
+
+static_assert(near(hann<5>(), vector{0., 0.5, 1., 0.5, 0.}), "hann");
+
+static_assert(near(hamming<3>(), vector{0.08, 1., 0.08}), "hamming");
+
+static_assert(near(blackman<3>(), vector{0., 1., 0.}), "blackman");
+
+static_assert(near(lowpass<3>(0.25, fill<3>(1.)),
+                   vector{2., 3.141592653589793, 2.} *
+                       (1 / (3.141592653589793 + 4))),
+              "lowpass");
+
+static_assert(cotila::abs(sum(lowpass<31>(0.1)) - 1) < 1e-15, "lowpass DC gain");
+
+static_assert(fir(vector{0.5, 0.5}).process(vector{2., 4., 6.}) ==
+                  vector{1., 3., 5.},
+              "fir");
+
+constexpr vector<double, 600> ramp = iota<600>(1.);
+
+// Filter in uneven pieces, crossing internal block boundaries
+template <typename Filter, std::size_t N>
+constexpr vector<double, N> filter_in_pieces(Filter filter, const vector<double, N> &v) {
+  vector<double, N> filtered = {};
+  std::size_t pieces[] = {1, 299, 3, 297};
+  std::size_t offset = 0;
+  for (auto n : pieces) {
+    filter.process(v.array + offset, filtered.array + offset, n);
+    offset += n;
+  }
+  return filtered;
+}
+
+static_assert(filter_in_pieces(fir(vector{1., -1.}), ramp) ==
+                  concat(vector{1.}, fill<599>(1.)),
+              "fir state");
+
+static_assert(filter_in_pieces(fir(vector{1., 2., 3.}), ramp) ==
+                  concat(vector{1., 4.}, generate<598>([](std::size_t i) {
+                           return 6. * (i + 3) - 8.;
+                         })),
+              "fir state");
+
+constexpr vector<double, 12> decimated = [] {
+  decimator<double, 3, 4> filter(vector{1., 1., 1.});
+  vector<double, 12> outputs = {};
+  std::size_t written = 0;
+  for (std::size_t i = 0; i < 48; i += 5) {
+    std::size_t n = i + 5 <= 48 ? 5 : 48 - i;
+    written += filter.process(ramp.array + i, outputs.array + written, n);
+  }
+  return outputs;
+}();
+
+static_assert(decimated == generate<12>([](std::size_t j) {
+                return j == 0 ? 1. : 3. * (4 * j) ;
+              }),
+              "decimator");
+
+static_assert(decimator<double, 2, 2>(vector{1., 1.}).process(vector{1., 2., 3., 4.}) ==
+                  vector{1., 5.},
+              "decimator");
+
+constexpr auto line = make_lut<5>([](double x) { return 2. * x - 1.; }, 0., 2.);
+
+static_assert(line(0.75) == 0.5 && line(2.) == 3., "linear lookup table");
+
+static_assert(line(-1.) == -1. && line(5.) == 3., "lookup table clamping");
+
+static_assert(line(vector{0., 0.25, 1.5}) == vector{-1., -0.5, 2.},
+              "lookup table vector");
+
+// Central differences are exact for quadratics away from the ends
+constexpr auto parabola = make_lut<9, interpolation::hermite>(
+    [](double x) { return x * x; }, -4., 4.);
+
+static_assert(near(parabola(vector{-1.5, 0.25, 2.75}),
+                   vector{2.25, 0.0625, 7.5625}),
+              "hermite lookup table");
+
+// A spline passes through its samples
+constexpr auto cubic = make_lut<7, interpolation::spline>(
+    [](double x) { return x * x * x - 3. * x * x; }, 0., 3.);
+
+static_assert(near(cubic(vector{0., 0.5, 1.5, 2.5, 3.}),
+                   vector{0., -0.625, -3.375, -3.125, 0.}),
+              "spline lookup table");
+
+constexpr auto smooth = make_lut<33, interpolation::spline>(
+    [](double x) { return cotila::sin(x); }, 0., 3.);
+
+static_assert(near(smooth(vector{0.3, 1.01, 2.2}),
+                   vector{cotila::sin(0.3), cotila::sin(1.01), cotila::sin(2.2)},
+                   1e-4),
+              "spline lookup table");
+
+} // namespace test
+} // namespace cotila
+
+#endif // COTILA_SIGNAL_TEST_H_
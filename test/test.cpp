@@ -1,5 +1,8 @@
+#include "cost_test.h"
 #include "matrix_test.h"
+#include "polynomial_test.h"
 #include "scalar_test.h"
+#include "signal_test.h"
 #include "vector_test.h"
 #include <iostream>
 
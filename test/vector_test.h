@@ -2,6 +2,7 @@
 #define COTILA_VECTOR_TEST_H_
 
 #include <complex>
+#include <limits>
 #include <string>
 #include <cotila/cotila.h>
 
@@ -89,6 +90,191 @@ static_assert(sum(vector{1,2,3}) == 6, "vector sum of integers");
 
 static_assert(abs(sum(vector{0.1,0.2,0.3}) - 0.6) < 1e-5, "vector sum of floating");
 
+static_assert(norm2(vector{3., 4.}) == 5, "norm2");
+
+static_assert(abs(norm2(vector{3e200, 4e200}) / 5e200 - 1) < 1e-15,
+              "norm2 without overflow");
+
+static_assert(abs(norm2(vector{3e-200, -4e-200}) / 5e-200 - 1) < 1e-15,
+              "norm2 without underflow");
+
+static_assert(norm2(vector{{{3., 4.}, {0., 0.}}}) == 5, "complex norm2");
+
+static_assert(norm2(vector{0., 0.}) == 0, "norm2 of zero");
+
+static_assert(norm2(vector{std::numeric_limits<double>::quiet_NaN(),
+                           std::numeric_limits<double>::quiet_NaN()}) !=
+                  norm2(vector{std::numeric_limits<double>::quiet_NaN(),
+                               std::numeric_limits<double>::quiet_NaN()}),
+              "norm2 of NaN");
+
+static_assert(norm2(vector{std::numeric_limits<double>::infinity(), 1.}) ==
+                      std::numeric_limits<double>::infinity() &&
+                  norm2(vector{1., -std::numeric_limits<double>::infinity()}) ==
+                      std::numeric_limits<double>::infinity(),
+              "norm2 of infinity");
+
+static_assert(norm2(vector<std::complex<double>, 2>{
+                  {{1., std::numeric_limits<double>::quiet_NaN()}, {2., 0.}}}) !=
+                  norm2(vector<std::complex<double>, 2>{
+                      {{1., std::numeric_limits<double>::quiet_NaN()}, {2., 0.}}}),
+              "complex norm2 of NaN");
+
+static_assert(norm2(vector{4.9e-324, 0.}) == 4.9e-324 &&
+                  norm2(vector{0., -4.9e-324, 4.9e-324}) == 4.9e-324,
+              "norm2 of subnormals");
+
+static_assert(abs(norm2(vector{1e-320, 1e-320}) / 1.4142135623730951e-320 - 1) <
+                  1e-3,
+              "norm2 of subnormals");
+
+static_assert(norm2(vector{3.L, 4.L}) == 5.L &&
+                  norm2(vector<std::complex<long double>, 2>{
+                      {{3.L, 4.L}, {0.L, 0.L}}}) == 5.L,
+              "long double norm2");
+
+static_assert(abs(norm2(vector{3e-4000L, 4e-4000L}) / 5e-4000L - 1) < 1e-18L,
+              "long double norm2 without underflow");
+
+static_assert(normalize(vector{3.L, 4.L}) == vector{0.6L, 0.8L} &&
+                  cosine_distance(vector{1.L, 0.L}, vector{0.L, 2.L}) == 1.L,
+              "long double normalize");
+
+static_assert(norm1(vector{3., -4., 1.}) == 8, "norm1");
+
+static_assert(norminf(vector{3., -4., 1.}) == 4, "norminf");
+
+static_assert(norminf(vector{{{3., 4.}, {1., 0.}}}) == 5, "complex norminf");
+
+static_assert(squared_distance(normalize(vector{3., 0., -4.}),
+                               vector{0.6, 0., -0.8}) < 1e-30,
+              "normalize");
+
+static_assert(squared_distance(vector{1., 2., 3.}, vector{2., 0., 3.}) == 5,
+              "squared distance");
+
+static_assert(l1_distance(vector{1., 2., 3.}, vector{2., 0., 3.}) == 3,
+              "L1 distance");
+
+static_assert(cosine_distance(vector{1., 0.}, vector{0., 2.}) == 1,
+              "cosine distance");
+
+static_assert(cosine_distance(vector{1., 1.}, vector{-2., -2.}) == 2,
+              "cosine distance");
+
+static_assert(
+    [] {
+      vector<double, 2> points[] = {{0., 0.}, {4., 4.}, {1., 2.}, {1., 2.}};
+      return nearest(vector{2., 2.}, points, 4);
+    }() == 2,
+    "nearest");
+
+// Checks every 0-1 input (which suffices to show that a comparator network
+// sorts every input)
+template <std::size_t N> constexpr bool sorts_zero_one() {
+  for (std::size_t bits = 0; bits < (std::size_t(1) << N); ++bits) {
+    vector<int, N> v = {};
+    for (std::size_t i = 0; i < N; ++i)
+      v[i] = (bits >> i) & 1;
+    auto sorted = sort(v);
+    for (std::size_t i = 1; i < N; ++i)
+      if (sorted[i] < sorted[i - 1])
+        return false;
+  }
+  return true;
+}
+
+static_assert(sorts_zero_one<1>() && sorts_zero_one<2>() &&
+                  sorts_zero_one<3>() && sorts_zero_one<5>() &&
+                  sorts_zero_one<7>() && sorts_zero_one<9>() &&
+                  sorts_zero_one<12>(),
+              "sorting network");
+
+// A permutation of 0, ..., N - 1 in scrambled order
+template <std::size_t N> constexpr vector<long, N> scrambled() {
+  return generate<N>([](std::size_t i) { return long((i * 7 + 3) % N); });
+}
+
+static_assert(sort(scrambled<25>()) == iota<25>(0l), "sort");
+
+static_assert(sort(scrambled<32>()) == iota<32>(0l), "sort");
+
+static_assert(sort(vector{3., -1., 2., -1.}) == vector{-1., -1., 2., 3.},
+              "sort");
+
+// Checks that the sorted vector contains the same elements, counting NaN
+template <std::size_t N>
+constexpr bool same_elements(const vector<double, N> &a,
+                             const vector<double, N> &b) {
+  for (std::size_t i = 0; i < N; ++i) {
+    std::size_t in_a = 0, in_b = 0;
+    for (std::size_t j = 0; j < N; ++j) {
+      bool nan = a[i] != a[i];
+      in_a += nan ? a[j] != a[j] : a[j] == a[i];
+      in_b += nan ? b[j] != b[j] : b[j] == a[i];
+    }
+    if (in_a != in_b)
+      return false;
+  }
+  return true;
+}
+
+static_assert(same_elements(sort(vector{std::numeric_limits<double>::quiet_NaN(), 1.}),
+                            vector{std::numeric_limits<double>::quiet_NaN(), 1.}) &&
+                  same_elements(sort(vector{2., std::numeric_limits<double>::quiet_NaN(), 1.}),
+                                vector{2., std::numeric_limits<double>::quiet_NaN(), 1.}),
+              "sort with NaN");
+
+static_assert(argsort(vector{3., -1., 2., -1.}) == vector<std::size_t, 4>{1, 3, 2, 0},
+              "argsort");
+
+static_assert(nth_element<0>(scrambled<9>()) == 0 &&
+                  nth_element<4>(scrambled<9>()) == 4 &&
+                  nth_element<8>(scrambled<9>()) == 8,
+              "nth_element");
+
+static_assert(detail::selection_network<9, 4>.size() <
+                  detail::sorting_network<9>.size(),
+              "selection network");
+
+static_assert(median(scrambled<25>()) == 12, "median");
+
+static_assert(median(vector{4., 1., 3., 2.}) == 2.5, "median");
+
+static_assert(median(vector{5}) == 5, "median");
+
+static_assert(median(vector{2000000000, 2000000000}) == 2000000000 &&
+                  median(vector{std::numeric_limits<int>::max(),
+                                std::numeric_limits<int>::min()}) == -1 &&
+                  median(vector{-3, -2}) == -3,
+              "median of integers without overflow");
+
+static_assert(inclusive_scan(vector{3, 1, 4, 1, 5}, [](int a, int b) { return a > b ? a : b; }) ==
+                  vector{3, 3, 4, 4, 5},
+              "inclusive scan");
+
+static_assert(exclusive_scan(vector{1, 2, 3, 4}, 10l, std::plus<long>()) ==
+                  vector{10l, 11l, 13l, 16l},
+              "exclusive scan");
+
+static_assert(cumsum(iota<9>(1)) == vector{1, 3, 6, 10, 15, 21, 28, 36, 45},
+              "integer cumsum");
+
+static_assert(cumsum(vector{0.5, 0.25, 1.}) == vector{0.5, 0.75, 1.75}, "cumsum");
+
+static_assert(cumsum(vector<std::complex<double>, 2>{{{1., 1.}, {2., -1.}}}) ==
+                  vector<std::complex<double>, 2>{{{1., 1.}, {3., 0.}}},
+              "complex cumsum");
+
+static_assert(cumprod(iota<6>(1l)) == vector{1l, 2l, 6l, 24l, 120l, 720l},
+              "integer cumprod");
+
+static_assert(cumprod(vector{2., 0.5, 3.}) == vector{2., 1., 3.}, "cumprod");
+
+static_assert(diff(vector{1, 4, 9, 16}) == vector{3, 5, 7}, "diff");
+
+static_assert(diff(cumsum(scrambled<25>())) == slice<24>(scrambled<25>(), 1),
+              "diff of cumsum");
 
 } // namespace cotila::test
 